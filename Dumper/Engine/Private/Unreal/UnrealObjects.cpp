@@ -1,4 +1,5 @@
 #include <format>
+#include <mutex>
 
 #include "Unreal/UnrealObjects.h"
 #include "Unreal/ObjectArray.h"
@@ -342,14 +343,8 @@ std::string UEObject::GetValidName() const
 
 std::string UEObject::GetCppName() const
 {
-	static UEClass ActorClass = nullptr;
-	static UEClass InterfaceClass = nullptr;
-
-	if (ActorClass == nullptr)
-		ActorClass = ObjectArray::FindClassFast("Actor");
-
-	if (InterfaceClass == nullptr)
-		InterfaceClass = ObjectArray::FindClassFast("Interface");
+	static UEClass ActorClass = ObjectArray::FindClassFast("Actor");
+	static UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
 
 	std::string Temp = GetValidName();
 
@@ -1087,7 +1082,7 @@ int32 UEProperty::GetAlignment() const
 	{
 		static std::unordered_map<void*, int32> UnknownProperties;
 
-		static auto TryFindPropertyRefInOptionalToGetAlignment = [](std::unordered_map<void*, int32>& OutProperties, void* PropertyClass) -> int32
+		static auto TryFindPropertyRefInOptionalToGetAlignment = [](void* PropertyClass) -> int32
 		{
 			/* Search for a TOptionalProperty that contains an instance of this property */
 			for (UEObject Obj : ObjectArray())
@@ -1101,23 +1096,41 @@ int32 UEProperty::GetAlignment() const
 						continue;
 
 					UEOptionalProperty Optional = Prop.Cast<UEOptionalProperty>();
+					UEProperty ValueProperty = Optional.GetValueProperty();
 
 					/* Safe to use first member, as we're guaranteed to use FProperty */
-					if (Optional.GetValueProperty().GetClass().second.GetAddress() == PropertyClass)
-						return OutProperties.insert({ PropertyClass, Optional.GetAlignment() }).first->second;
+					if (ValueProperty.GetClass().second.GetAddress() != PropertyClass)
+						continue;
+
+					/* Without the bool the optional is aligned like this property, asking it for its alignment would end up back here */
+					if (ValueProperty.GetSize() == Optional.GetSize())
+						continue;
+
+					return Optional.GetSize() - ValueProperty.GetSize();
 				}
 			}
 
-			return OutProperties.insert({ PropertyClass, 0x1 }).first->second;
+			return 0x1;
 		};
 
-		auto It = UnknownProperties.find(GetClass().second.GetAddress());
+		/* Alignments are computed from multiple threads, see StructManager::InitLayouts(). The lock isn't held during the search over GObjects. */
+		static std::mutex UnknownPropertiesMutex;
+
+		void* const PropertyClass = GetClass().second.GetAddress();
+
+		{
+			std::scoped_lock Lock(UnknownPropertiesMutex);
+
+			if (auto It = UnknownProperties.find(PropertyClass); It != UnknownProperties.end())
+				return It->second;
+		}
+
+		const int32 Alignment = TryFindPropertyRefInOptionalToGetAlignment(PropertyClass);
 
-		/* Safe to use first member, as we're guaranteed to use FProperty */
-		if (It == UnknownProperties.end())
-			return TryFindPropertyRefInOptionalToGetAlignment(UnknownProperties, GetClass().second.GetAddress());
+		/* Threads that searched concurrently found the same alignment, the first one is kept */
+		std::scoped_lock Lock(UnknownPropertiesMutex);
 
-		return It->second;
+		return UnknownProperties.try_emplace(PropertyClass, Alignment).first->second;
 	}
 
 	return 0x1;
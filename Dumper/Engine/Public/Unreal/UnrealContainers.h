@@ -179,7 +179,7 @@ namespace UC
 		{
 		private:
 			template<typename SetDataType>
-			friend class TSet;
+			friend class UC::TSet;
 
 		private:
 			SetType Value;
@@ -645,6 +645,34 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/*
+		* Walks the bucket of 'KeyHash' and its 'HashNextId' chain, like the engine does. 'KeyHash' has to be the hash the engine used for the key.
+		* Returns the index of the first element in the chain for which 'IsMatch' returns true, or -1.
+		*/
+		template<typename PredicateType>
+		inline int32 FindIndexByHash(uint32 KeyHash, PredicateType&& IsMatch) const
+		{
+			if (HashSize <= 0 || !Elements.IsValid())
+				return -1;
+
+			const int32* Buckets = Hash.GetAllocation();
+
+			/* Bounded, as a chain read while the engine modifies the set can contain a loop */
+			int32 NumVisited = 0;
+
+			for (int32 Index = Buckets[KeyHash & (HashSize - 1)]; Index != -1 && NumVisited < NumAllocated(); Index = Elements[Index].HashNextId, NumVisited++)
+			{
+				if (!Elements.IsValidIndex(Index))
+					return -1;
+
+				if (IsMatch(Elements[Index].Value))
+					return Index;
+			}
+
+			return -1;
+		}
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
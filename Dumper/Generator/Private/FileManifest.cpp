@@ -0,0 +1,258 @@
+#include <fstream>
+#include <format>
+#include <charconv>
+#include <iostream>
+
+#include "FileManifest.h"
+#include "Settings.h"
+
+
+std::string FileManifest::GetKey(const std::filesystem::path& FilePath)
+{
+	const std::filesystem::path RelativePath = FilePath.lexically_normal().lexically_relative(DumperFolder.lexically_normal());
+
+	if (RelativePath.empty() || *RelativePath.begin() == "..")
+		return std::string();
+
+	const std::u8string U8Key = RelativePath.generic_u8string();
+
+	return std::string(reinterpret_cast<const char*>(U8Key.data()), U8Key.size());
+}
+
+int64 FileManifest::GetWriteTime(const std::filesystem::path& FilePath)
+{
+	std::error_code ec;
+	const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath, ec);
+
+	return ec ? 0x0 : static_cast<int64>(WriteTime.time_since_epoch().count());
+}
+
+void FileManifest::Load()
+{
+	std::ifstream ManifestFile(DumperFolder / Settings::Generator::ManifestFileName);
+
+	if (!ManifestFile.is_open())
+		return;
+
+	std::string Line;
+
+	/* Manifests of other versions are ignored, every file is rewritten once */
+	if (!std::getline(ManifestFile, Line) || Line != std::format("{} {}", ManifestHeader, ManifestVersion))
+		return;
+
+	while (std::getline(ManifestFile, Line))
+	{
+		std::string_view Remaining = Line;
+
+		auto GetNextToken = [&Remaining]() -> std::string_view
+		{
+			const size_t SpacePos = Remaining.find(' ');
+
+			if (SpacePos == std::string_view::npos)
+				return std::string_view();
+
+			const std::string_view Token = Remaining.substr(0, SpacePos);
+			Remaining.remove_prefix(SpacePos + 1);
+
+			return Token;
+		};
+
+		const std::string_view HashString = GetNextToken();
+		const std::string_view WriteTimeString = GetNextToken();
+		const std::string_view Owner = GetNextToken();
+
+		/* The remaining part of the line is the path, which can contain spaces */
+		if (Owner.empty() || Remaining.empty())
+			continue;
+
+		FileEntry Entry;
+
+		if (std::from_chars(HashString.data(), HashString.data() + HashString.size(), Entry.Hash, 16).ec != std::errc())
+			continue;
+
+		if (std::from_chars(WriteTimeString.data(), WriteTimeString.data() + WriteTimeString.size(), Entry.WriteTime).ec != std::errc())
+			continue;
+
+		Entry.Owner = Owner;
+
+		PreviousEntries.emplace(std::string(Remaining), std::move(Entry));
+	}
+}
+
+void FileManifest::Save()
+{
+	std::ofstream ManifestFile(DumperFolder / Settings::Generator::ManifestFileName);
+
+	if (!ManifestFile.is_open())
+	{
+		std::cerr << "Error opening file manifest, the next run will regenerate every file." << std::endl;
+		return;
+	}
+
+	ManifestFile << std::format("{} {}\n", ManifestHeader, ManifestVersion);
+
+	/* Entries of generators that didn't run yet are kept, so they can update their files incrementally as well */
+	for (const auto& [Key, Entry] : PreviousEntries)
+		ManifestFile << std::format("{:X} {} {} {}\n", Entry.Hash, Entry.WriteTime, Entry.Owner, Key);
+
+	for (const auto& [Key, Entry] : CurrentEntries)
+		ManifestFile << std::format("{:X} {} {} {}\n", Entry.Hash, Entry.WriteTime, Entry.Owner, Key);
+}
+
+void FileManifest::Init(const std::filesystem::path& InDumperFolder)
+{
+	DumperFolder = InDumperFolder;
+
+	PreviousEntries.clear();
+	CurrentEntries.clear();
+
+	if (IsEnabled())
+		Load();
+}
+
+bool FileManifest::IsEnabled()
+{
+	return Settings::Generator::ManifestFileName != nullptr && !DumperFolder.empty();
+}
+
+bool FileManifest::HasPreviousFiles()
+{
+	return !PreviousEntries.empty();
+}
+
+bool FileManifest::HasPreviousFiles(const std::string& Owner)
+{
+	for (const auto& [Key, Entry] : PreviousEntries)
+	{
+		if (Entry.Owner == Owner)
+			return true;
+	}
+
+	return false;
+}
+
+void FileManifest::BeginGenerator(const std::string& Owner)
+{
+	CurrentOwner = Owner;
+}
+
+void FileManifest::EndGenerator()
+{
+	if (!IsEnabled())
+		return;
+
+	std::vector<std::filesystem::path> StaleFiles;
+
+	for (auto It = PreviousEntries.begin(); It != PreviousEntries.end(); )
+	{
+		if (It->second.Owner != CurrentOwner)
+		{
+			++It;
+			continue;
+		}
+
+		if (!CurrentEntries.contains(It->first))
+			StaleFiles.push_back(DumperFolder / std::u8string(reinterpret_cast<const char8_t*>(It->first.data()), It->first.size()));
+
+		It = PreviousEntries.erase(It);
+	}
+
+	if (!StaleFiles.empty())
+	{
+		std::cerr << std::format("{}: Removing {} files which are no longer generated.\n", CurrentOwner, StaleFiles.size());
+
+		PendingDeletions.push_back(std::async(std::launch::async, [Files = std::move(StaleFiles)]() -> void
+		{
+			std::error_code ec;
+
+			for (const std::filesystem::path& File : Files)
+				std::filesystem::remove(File, ec);
+		}));
+	}
+
+	Save();
+
+	CurrentOwner.clear();
+}
+
+void FileManifest::RemoveInBackground(std::filesystem::path Path)
+{
+	PendingDeletions.push_back(std::async(std::launch::async, [Path = std::move(Path)]() -> void
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(Path, ec);
+	}));
+}
+
+void FileManifest::WaitForPendingDeletions()
+{
+	for (std::future<void>& Deletion : PendingDeletions)
+		Deletion.wait();
+
+	PendingDeletions.clear();
+}
+
+/* FNV-1a */
+uint64 FileManifest::HashContent(std::string_view Content)
+{
+	uint64 Hash = 0xCBF29CE484222325;
+
+	for (const char Char : Content)
+	{
+		Hash ^= static_cast<uint8>(Char);
+		Hash *= 0x100000001B3;
+	}
+
+	return Hash;
+}
+
+bool FileManifest::NeedsWrite(const std::filesystem::path& FilePath, uint64 Hash)
+{
+	if (!IsEnabled())
+		return true;
+
+	const std::string Key = GetKey(FilePath);
+
+	if (Key.empty())
+		return true;
+
+	int64 PreviousWriteTime = 0x0;
+
+	{
+		std::scoped_lock Lock(EntriesLock);
+
+		auto It = PreviousEntries.find(Key);
+
+		if (It == PreviousEntries.end() || It->second.Hash != Hash)
+			return true;
+
+		PreviousWriteTime = It->second.WriteTime;
+	}
+
+	/* The file was deleted or modified since it was generated */
+	const int64 WriteTime = GetWriteTime(FilePath);
+
+	if (WriteTime == 0x0 || WriteTime != PreviousWriteTime)
+		return true;
+
+	std::scoped_lock Lock(EntriesLock);
+	CurrentEntries[Key] = FileEntry{ Hash, WriteTime, CurrentOwner };
+
+	return false;
+}
+
+void FileManifest::OnFileWritten(const std::filesystem::path& FilePath, uint64 Hash)
+{
+	if (!IsEnabled())
+		return;
+
+	const std::string Key = GetKey(FilePath);
+
+	if (Key.empty())
+		return;
+
+	const int64 WriteTime = GetWriteTime(FilePath);
+
+	std::scoped_lock Lock(EntriesLock);
+	CurrentEntries[Key] = FileEntry{ Hash, WriteTime, CurrentOwner };
+}
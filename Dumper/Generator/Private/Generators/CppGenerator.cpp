@@ -1,5 +1,9 @@
 #include <vector>
 #include <array>
+#include <numeric>
+#include <algorithm>
+#include <execution>
+#include <shared_mutex>
 
 #include "Unreal/ObjectArray.h"
 #include "Generators/CppGenerator.h"
@@ -9,7 +13,7 @@
 
 #include "../Settings.h"
 
-constexpr std::string GetTypeFromSize(uint8 Size)
+constexpr const char* GetTypeFromSize(uint8 Size)
 {
 	switch (Size)
 	{
@@ -26,17 +30,179 @@ constexpr std::string GetTypeFromSize(uint8 Size)
 	}
 }
 
-std::string CppGenerator::MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment)
+/* For names written into string literals */
+std::string PrefixQuotsWithBackslash(std::string&& Str)
+{
+	for (int i = 0; i < Str.size(); i++)
+	{
+		if (Str[i] == '"')
+		{
+			Str.insert(i, "\\");
+			i++;
+		}
+	}
+
+	return Str;
+}
+
+/* Names of generated globals derived from type names, 'Pkg::UFoo' -> 'Pkg_UFoo' */
+std::string MakeGlobalIdentifier(std::string Name)
+{
+	for (size_t Pos = Name.find("::"); Pos != std::string::npos; Pos = Name.find("::", Pos + 1))
+		Name.replace(Pos, 2, "_");
+
+	return Name;
+}
+
+/* Same hash as 'BasicFilesImpleUtils::HashTableName()' in the generated Basic.hpp, seeded FNV-1a */
+constexpr uint32 HashTableName(std::string_view Name, uint32 Seed)
+{
+	uint32 Hash = 0x811C9DC5 ^ Seed;
+
+	for (const char Char : Name)
+		Hash = (Hash ^ static_cast<uint8>(Char)) * 0x01000193;
+
+	return Hash;
+}
+
+/* Minimal perfect hash over a set of unique names, the layout of 'BasicFilesImpleUtils::TPerfectHashTable' */
+struct PerfectHashTable
+{
+	/* Seed of every bucket. Seeds with the highest bit set hold the slot of a bucket with a single name. */
+	std::vector<uint32> Seeds;
+
+	/* Slot of every name, in the order the names were passed */
+	std::vector<int32> Slots;
+};
+
+/*
+* Hash-and-displace: names are distributed to NumNames / 2 buckets, buckets with several names are placed first by searching for a seed that moves
+* all of their names to free slots. Buckets with a single name take the next free slot directly. The bucket-count is doubled if no seed is found.
+*/
+PerfectHashTable BuildPerfectHashTable(const std::vector<std::string_view>& Names)
+{
+	constexpr uint32 MaxSeed = 0x100000;
+	constexpr uint32 DirectSlotFlag = 0x80000000;
+
+	const int32 NumSlots = static_cast<int32>(Names.size());
+
+	for (int32 NumBuckets = std::max(NumSlots / 2, 1); ; NumBuckets *= 2)
+	{
+		std::vector<std::vector<int32>> Buckets(NumBuckets);
+
+		for (int32 i = 0; i < NumSlots; i++)
+			Buckets[HashTableName(Names[i], 0x0) % NumBuckets].push_back(i);
+
+		std::vector<int32> BucketOrder(NumBuckets);
+		std::iota(BucketOrder.begin(), BucketOrder.end(), 0x0);
+		std::stable_sort(BucketOrder.begin(), BucketOrder.end(), [&](int32 Left, int32 Right) { return Buckets[Left].size() > Buckets[Right].size(); });
+
+		PerfectHashTable Table = { std::vector<uint32>(NumBuckets, 0x0), std::vector<int32>(NumSlots, -1) };
+		std::vector<bool> bIsSlotUsed(NumSlots, false);
+
+		int32 NextFreeSlot = 0x0;
+		bool bFoundAllSeeds = true;
+
+		for (const int32 BucketIndex : BucketOrder)
+		{
+			const std::vector<int32>& Bucket = Buckets[BucketIndex];
+
+			if (Bucket.empty())
+				break;
+
+			if (Bucket.size() == 1)
+			{
+				while (bIsSlotUsed[NextFreeSlot])
+					NextFreeSlot++;
+
+				bIsSlotUsed[NextFreeSlot] = true;
+				Table.Seeds[BucketIndex] = DirectSlotFlag | NextFreeSlot;
+				Table.Slots[Bucket[0]] = NextFreeSlot;
+				continue;
+			}
+
+			std::vector<int32> BucketSlots(Bucket.size());
+			bool bFoundSeed = false;
+
+			for (uint32 Seed = 0x1; Seed < MaxSeed && !bFoundSeed; Seed++)
+			{
+				bFoundSeed = true;
+
+				for (int32 i = 0; i < Bucket.size() && bFoundSeed; i++)
+				{
+					BucketSlots[i] = HashTableName(Names[Bucket[i]], Seed) % NumSlots;
+
+					bFoundSeed = !bIsSlotUsed[BucketSlots[i]] && std::find(BucketSlots.begin(), BucketSlots.begin() + i, BucketSlots[i]) == (BucketSlots.begin() + i);
+				}
+
+				if (!bFoundSeed)
+					continue;
+
+				Table.Seeds[BucketIndex] = Seed;
+
+				for (int32 i = 0; i < Bucket.size(); i++)
+				{
+					bIsSlotUsed[BucketSlots[i]] = true;
+					Table.Slots[Bucket[i]] = BucketSlots[i];
+				}
+			}
+
+			if (!bFoundSeed)
+			{
+				bFoundAllSeeds = false;
+				break;
+			}
+		}
+
+		if (bFoundAllSeeds)
+			return Table;
+	}
+}
+
+/* Definition of a constexpr 'BasicFilesImpleUtils::TPerfectHashTable' variable, 'Values[i]' is the initializer of the value of 'Names[i]' */
+std::string MakePerfectHashTableDefinition(const std::string& VariableName, const std::string& ValueType, const std::vector<std::string_view>& Names, const std::vector<std::string>& Values)
+{
+	const PerfectHashTable Table = BuildPerfectHashTable(Names);
+
+	std::vector<std::string> EntriesBySlot(Names.size());
+
+	for (int32 i = 0; i < Names.size(); i++)
+		EntriesBySlot[Table.Slots[i]] = std::format("\t\t{{ \"{}\", {} }},\n", PrefixQuotsWithBackslash(std::string(Names[i])), Values[i]);
+
+	std::string EntriesText;
+
+	for (const std::string& Entry : EntriesBySlot)
+		EntriesText += Entry;
+
+	std::string SeedsText;
+
+	for (int32 i = 0; i < Table.Seeds.size(); i++)
+		SeedsText += std::format("{}0x{:08X},{}", (i % 8) == 0 ? "\t\t" : " ", Table.Seeds[i], (i % 8) == 7 || (i + 1) == Table.Seeds.size() ? "\n" : "");
+
+	return std::format(R"(inline constexpr BasicFilesImpleUtils::TPerfectHashTable<{}, 0x{:X}, 0x{:X}> {} = {{
+	{{
+{}	}},
+	{{
+{}	}},
+}};
+)", ValueType, Names.size(), Table.Seeds.size(), VariableName, EntriesText, SeedsText);
+}
+
+/* Name must include the trailing ';' */
+template<typename... ArgTypes>
+void CppGenerator::WriteMember(OutputBuffer& Out, std::string_view Type, std::string_view Name, std::format_string<ArgTypes...> CommentFmt, ArgTypes&&... CommentArgs)
 {
 	//<tab><--45 chars--><-------50 chars----->
 	//     Type          MemberName;           // Comment
+	const size_t NameLength = Name.length() - 1;
+
 	int NumSpacesToComment;
 
 	if (Type.length() < 45)
 	{
 		NumSpacesToComment = 50;
 	}
-	else if ((Type.length() + Name.length()) > 95)
+	else if ((Type.length() + NameLength) > 95)
 	{
 		NumSpacesToComment = 1;
 	}
@@ -45,32 +211,42 @@ std::string CppGenerator::MakeMemberString(const std::string& Type, const std::s
 		NumSpacesToComment = 50 - (Type.length() - 45);
 	}
 
-	return std::format("\t{:{}} {:{}} // {}\n", Type, 45, Name + ";", NumSpacesToComment, std::move(Comment));
+	Out.Format("\t{:{}} {:{}} // ", Type, 45, Name, NumSpacesToComment);
+	Out.Format(CommentFmt, std::forward<ArgTypes>(CommentArgs)...);
+	Out << '\n';
 }
 
-std::string CppGenerator::MakeMemberStringWithoutName(const std::string& Type)
+void CppGenerator::WriteMemberWithoutName(OutputBuffer& Out, std::string_view Type)
 {
-	return '\t' + Type + ";\n";
+	Out << '\t' << Type << ";\n";
 }
 
-std::string CppGenerator::GenerateBytePadding(const int32 Offset, const int32 PadSize, std::string&& Reason)
+void CppGenerator::WriteBytePadding(OutputBuffer& Out, const int32 Offset, const int32 PadSize, std::string_view Reason)
 {
-	return MakeMemberString("uint8", std::format("Pad_{:X}[0x{:X}]", Offset, PadSize), std::format("0x{:04X}(0x{:04X})({})", Offset, PadSize, std::move(Reason)));
+	thread_local std::string PadName;
+
+	PadName.clear();
+	std::format_to(std::back_inserter(PadName), "Pad_{:X}[0x{:X}];", Offset, PadSize);
+
+	WriteMember(Out, "uint8", PadName, "0x{:04X}(0x{:04X})({})", Offset, PadSize, Reason);
 }
 
-std::string CppGenerator::GenerateBitPadding(uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string&& Reason)
+void CppGenerator::WriteBitPadding(OutputBuffer& Out, uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string_view Reason)
 {
-	return MakeMemberString(GetTypeFromSize(UnderlayingSizeBytes), std::format("BitPad_{:X}_{:X} : {:d}", Offset, PrevBitPropertyEndBit, PadSize), std::format("0x{:04X}(0x{:04X})({})", Offset, UnderlayingSizeBytes, std::move(Reason)));
+	thread_local std::string PadName;
+
+	PadName.clear();
+	std::format_to(std::back_inserter(PadName), "BitPad_{:X}_{:X} : {:d};", Offset, PrevBitPropertyEndBit, PadSize);
+
+	WriteMember(Out, GetTypeFromSize(UnderlayingSizeBytes), PadName, "0x{:04X}(0x{:04X})({})", Offset, UnderlayingSizeBytes, Reason);
 }
 
-std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex)
+void CppGenerator::GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, OutputBuffer& StructFile, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex)
 {
-	constexpr uint64 EstimatedCharactersPerLine = 0xF0;
-
 	const bool bIsUnion = Struct.IsUnion();
 
-	std::string OutMembers;
-	OutMembers.reserve(Members.GetNumMembers() * EstimatedCharactersPerLine);
+	/* Reused for all members generated on this thread */
+	thread_local std::string MemberName;
 
 	bool bEncounteredZeroSizedVariable = false;
 	bool bEncounteredStaticVariable = false;
@@ -81,13 +257,13 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 	{
 		if (!bAddedSpaceStatic && bEncounteredZeroSizedVariable && !Member.IsZeroSizedMember()) [[unlikely]]
 		{
-			OutMembers += '\n';
+			StructFile << '\n';
 			bAddedSpaceZeroSized = true;
 		}
 
 		if (!bAddedSpaceStatic && bEncounteredStaticVariable && !Member.IsStatic()) [[unlikely]]
 		{
-			OutMembers += '\n';
+			StructFile << '\n';
 			bAddedSpaceStatic = true;
 		}
 
@@ -117,38 +293,35 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 
 		const int32 CurrentPropertyEnd = MemberOffset + MemberSize;
 
-		std::string Comment = std::format("0x{:04X}(0x{:04X})({})", MemberOffset, MemberSize, Member.GetFlagsOrCustomComment());
-
 		const bool bIsBitField = Member.IsBitField();
 
 		/* Padding between two bitfields at different byte-offsets */
 		if (CurrentPropertyEnd > PrevPropertyEnd && bLastPropertyWasBitField && bIsBitField && PrevBitPropertyEndBit < PrevNumBitsInUnderlayingType && !bIsUnion)
 		{
-			OutMembers += GenerateBitPadding(PrevBitPropertySize, PrevBitPropertyEndBit, PrevBitPropertyOffset, PrevNumBitsInUnderlayingType - PrevBitPropertyEndBit, "Fixing Bit-Field Size For New Byte [ Dumper-7 ]");
+			WriteBitPadding(StructFile, PrevBitPropertySize, PrevBitPropertyEndBit, PrevBitPropertyOffset, PrevNumBitsInUnderlayingType - PrevBitPropertyEndBit, "Fixing Bit-Field Size For New Byte [ Dumper-7 ]");
 			PrevBitPropertyEndBit = 0;
 		}
 
 		if (MemberOffset > PrevPropertyEnd && !bIsUnion)
-			OutMembers += GenerateBytePadding(PrevPropertyEnd, MemberOffset - PrevPropertyEnd, "Fixing Size After Last Property [ Dumper-7 ]");
+			WriteBytePadding(StructFile, PrevPropertyEnd, MemberOffset - PrevPropertyEnd, "Fixing Size After Last Property [ Dumper-7 ]");
 
 		bIsFirstSizedMember = Member.IsZeroSizedMember() || Member.IsStatic();
 
+		uint8 BitFieldIndex = 0x0;
+
 		if (bIsBitField)
 		{
-			const uint8 BitFieldIndex = Member.GetBitIndex();
+			BitFieldIndex = Member.GetBitIndex();
 			const uint8 BitSize = Member.GetBitCount();
 
 			if (CurrentPropertyEnd > PrevPropertyEnd)
 				PrevBitPropertyEndBit = 0x0;
 
-			std::string BitfieldInfoComment = std::format("BitIndex: 0x{:02X}, PropSize: 0x{:04X} ({})", BitFieldIndex, MemberSize, Member.GetFlagsOrCustomComment());
-			Comment = std::format("0x{:04X}(0x{:04X})({})", MemberOffset, MemberSize, BitfieldInfoComment);
-
 			if (PrevBitPropertyEnd < MemberOffset)
 				PrevBitPropertyEndBit = 0;
 
 			if (PrevBitPropertyEndBit < BitFieldIndex && !bIsUnion)
-				OutMembers += GenerateBitPadding(MemberSize, PrevBitPropertyEndBit, MemberOffset, BitFieldIndex - PrevBitPropertyEndBit, "Fixing Bit-Field Size Between Bits [ Dumper-7 ]");
+				WriteBitPadding(StructFile, MemberSize, PrevBitPropertyEndBit, MemberOffset, BitFieldIndex - PrevBitPropertyEndBit, "Fixing Bit-Field Size Between Bits [ Dumper-7 ]");
 
 			PrevBitPropertyEndBit = BitFieldIndex + BitSize;
 			PrevBitPropertyEnd = MemberOffset  + MemberSize;
@@ -164,39 +337,51 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 		if (!Member.IsStatic()) [[likely]]
 			PrevPropertyEnd = MemberOffset + (MemberSize * Member.GetArrayDim());
 
-		std::string MemberName = Member.GetName();
+		const bool bAllowForConstPtrMembers = Struct.IsFunction();
+
+		/* using directives */
+		if (Member.IsZeroSizedMember()) [[unlikely]]
+		{
+			WriteMemberWithoutName(StructFile, GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers));
+			continue;
+		}
+
+		MemberName.clear();
+		MemberName += Member.GetName();
 
 		if (Member.GetArrayDim() > 1)
 		{
-			MemberName += std::format("[0x{:X}]", Member.GetArrayDim());
+			std::format_to(std::back_inserter(MemberName), "[0x{:X}]", Member.GetArrayDim());
 		}
 		else if (bIsBitField)
 		{
-			MemberName += (" : " + std::to_string(Member.GetBitCount()));
+			std::format_to(std::back_inserter(MemberName), " : {}", Member.GetBitCount());
 		}
 
 		if (Member.HasDefaultValue()) [[unlikely]]
-			MemberName += (" = " + Member.GetDefaultValue());
+		{
+			MemberName += " = ";
+			MemberName += Member.GetDefaultValue();
+		}
 
-		const bool bAllowForConstPtrMembers = Struct.IsFunction();
+		MemberName += ';';
 
-		/* using directives */
-		if (Member.IsZeroSizedMember()) [[unlikely]]
+		const std::string MemberType = GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers);
+
+		if (bIsBitField)
 		{
-			OutMembers += MakeMemberStringWithoutName(GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers));
+			WriteMember(StructFile, MemberType, MemberName, "0x{:04X}(0x{:04X})(BitIndex: 0x{:02X}, PropSize: 0x{:04X} ({}))", MemberOffset, MemberSize, BitFieldIndex, MemberSize, Member.GetFlagsOrCustomComment());
 		}
-		else [[likely]]
+		else
 		{
-			OutMembers += MakeMemberString(GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers), MemberName, std::move(Comment));
+			WriteMember(StructFile, MemberType, MemberName, "0x{:04X}(0x{:04X})({})", MemberOffset, MemberSize, Member.GetFlagsOrCustomComment());
 		}
 	}
 
 	const int32 MissingByteCount = Struct.GetUnalignedSize() - PrevPropertyEnd;
 
 	if (MissingByteCount > 0x0 /* >=Struct.GetAlignment()*/)
-		OutMembers += GenerateBytePadding(PrevPropertyEnd, MissingByteCount, "Fixing Struct Size After Last Property [ Dumper-7 ]");
-
-	return OutMembers;
+		WriteBytePadding(StructFile, PrevPropertyEnd, MissingByteCount, "Fixing Struct Size After Last Property [ Dumper-7 ]");
 }
 
 CppGenerator::FunctionInfo CppGenerator::GenerateFunctionInfo(const FunctionWrapper& Func)
@@ -292,7 +477,7 @@ CppGenerator::FunctionInfo CppGenerator::GenerateFunctionInfo(const FunctionWrap
 	return RetFuncInfo;
 }
 
-std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile)
+std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile, int32 FunctionTableIndex)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
@@ -347,7 +532,7 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	{
 		std::string CustomComment = Func.GetPredefFunctionCustomComment();
 
-		FunctionFile << std::format(R"(
+		FunctionFile.Format(R"(
 // Predefined Function
 {}
 {}{}{}::{}{}
@@ -437,22 +622,48 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 
 	const bool bIsNativeFunc = Func.HasFunctionFlag(EFunctionFlags::Native);
 
-	static auto PrefixQuotsWithBackslash = [](std::string&& Str) -> std::string
+	std::string FunctionLookupString;
+
+	if (FunctionTableIndex >= 0)
 	{
-		for (int i = 0; i < Str.size(); i++)
-		{
-			if (Str[i] == '"')
-			{
-				Str.insert(i, "\\");
-				i++;
-			}
-		}
+		FunctionLookupString = std::format(R"(class UFunction* Func = {0}_Functions[0x{1:X}];
 
-		return Str;
-	};
+	if (Func == nullptr)
+		Func = {0}_ResolveFunction(0x{1:X});)", MakeGlobalIdentifier(StructName), FunctionTableIndex);
+	}
+	else
+	{
+		std::string FixedOuterName = PrefixQuotsWithBackslash(UnrealFunc.GetOuter().GetName());
+		std::string FixedFunctionName = PrefixQuotsWithBackslash(UnrealFunc.GetName());
 
-	std::string FixedOuterName = PrefixQuotsWithBackslash(UnrealFunc.GetOuter().GetName());
-	std::string FixedFunctionName = PrefixQuotsWithBackslash(UnrealFunc.GetName());
+		FunctionLookupString = std::format(R"(static class UFunction* Func = nullptr;
+
+	if (Func == nullptr)
+		Func = {}->GetFunction({}, {});)"
+		, Func.IsStatic() ? "StaticClass()" : Func.IsInInterface() ? "AsUObject()->Class" : "Class"
+		, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedOuterName) : std::format("\"{}\"", FixedOuterName)
+		, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedFunctionName) : std::format("\"{}\"", FixedFunctionName));
+	}
+
+	/* Only functions without parameters apart from the return-value, nothing has to be assigned to 'Parms' before the call */
+	const bool bCanCallNativeDirectly = CanCallNativeFunctionDirectly(Func);
+
+	std::string CallString;
+
+	if (bCanCallNativeDirectly)
+	{
+		CallString = std::format("BasicFilesImpleUtils::CallNativeFunction({}, Func, {}, {});"
+			, Func.IsStatic() ? "GetDefaultObj()" : "this"
+			, bHasParams ? "&Parms" : "nullptr"
+			, !FuncInfo.bIsReturningVoid ? "&Parms.ReturnValue" : "nullptr");
+	}
+	else
+	{
+		CallString = std::format("{}ProcessEvent(Func, {});{}"
+			, Func.IsStatic() ? "GetDefaultObj()->" : Func.IsInInterface() ? "AsUObject()->" : "UObject::"
+			, bHasParams ? "&Parms" : "nullptr"
+			, bIsNativeFunc ? RestoreFunctionFlagsString : "");
+	}
 
 	// Function implementation generation
 	std::string FunctionImplementation = std::format(R"(
@@ -461,12 +672,9 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 {}
 {} {}::{}{}
 {{
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = {}->GetFunction({}, {});
+	{}
 {}{}{}
-	{}ProcessEvent(Func, {});{}{}{}{}
+	{}{}{}{}
 }}
 
 )", UnrealFunc.GetFullName()
@@ -476,15 +684,11 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 , StructName
 , FuncInfo.FuncNameWithParams
 , bIsConstFunc ? " const" : ""
-, Func.IsStatic() ? "StaticClass()" : Func.IsInInterface() ? "AsUObject()->Class" : "Class"
-, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedOuterName) : std::format("\"{}\"", FixedOuterName)
-, CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, FixedFunctionName) : std::format("\"{}\"", FixedFunctionName)
+, FunctionLookupString
 , bHasParams ? ParamVarCreationString : ""
 , bHasParamsToInit ? ParamAssignments : ""
-, bIsNativeFunc ? StoreFunctionFlagsString : ""
-, Func.IsStatic() ? "GetDefaultObj()->" : Func.IsInInterface() ? "AsUObject()->" : "UObject::"
-, bHasParams ? "&Parms" : "nullptr"
-, bIsNativeFunc ? RestoreFunctionFlagsString : ""
+, bIsNativeFunc && !bCanCallNativeDirectly ? StoreFunctionFlagsString : ""
+, CallString
 , bHasOutRefParamsToInit ? OutRefAssignments : ""
 , bHasOutPtrParamsToInit ? OutPtrAssignments : ""
 , !FuncInfo.bIsReturningVoid ? ReturnValueString : "");
@@ -494,16 +698,96 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	return InHeaderFunctionText;
 }
 
-std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile)
+bool CppGenerator::CanCallNativeFunctionDirectly(const FunctionWrapper& Func)
+{
+	if constexpr (!Settings::CppGenerator::bGenerateNativeFastPath)
+		return false;
+
+	if (Func.IsPredefined() || !Func.HasFunctionFlag(EFunctionFlags::Native) || Func.IsInInterface())
+		return false;
+
+	/* Called through ProcessEvent for a reason, or not callable at all */
+	if (Func.HasFunctionFlag(EFunctionFlags::Event) || Func.HasFunctionFlag(EFunctionFlags::BlueprintEvent) || Func.HasFunctionFlag(EFunctionFlags::Net)
+		|| Func.HasFunctionFlag(EFunctionFlags::Delegate) || Func.HasFunctionFlag(EFunctionFlags::MulticastDelegate))
+		return false;
+
+	/* The thunk reads all other parameters from the stack-frame, which has no bytecode to read them from */
+	for (UEProperty Param : Func.GetUnrealFunction().GetProperties())
+	{
+		if (!Param.HasPropertyFlags(EPropertyFlags::ReturnParm))
+			return false;
+	}
+
+	return true;
+}
+
+bool CppGenerator::GenerateFunctionTable(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, OutputBuffer& FunctionFile)
+{
+	namespace CppSettings = Settings::CppGenerator;
+
+	/* Function names are stored as plain string-literals in the table */
+	if constexpr (!CppSettings::bGenerateFunctionTables || CppSettings::XORString)
+		return false;
+
+	/* The table is resolved through 'StaticClass()', which these don't have */
+	if (!Struct.IsUnrealStruct() || !Struct.IsClass() || !Struct.GetSuper().IsValid())
+		return false;
+
+	/* Name and index of the function in the table, which is the order in which the wrappers are generated */
+	std::vector<std::pair<std::string, int32>> Entries;
+
+	for (const FunctionWrapper& Func : Members.IterateFunctions())
+	{
+		if (Func.IsPredefined() || (Func.GetFunctionFlags() & EFunctionFlags::Delegate))
+			continue;
+
+		Entries.emplace_back(Func.GetUnrealFunction().GetName(), static_cast<int32>(Entries.size()));
+	}
+
+	if (Entries.empty())
+		return false;
+
+	/* Sorted by name, so every child of the class is matched with a binary search */
+	std::sort(Entries.begin(), Entries.end());
+
+	std::string EntriesText;
+
+	for (auto& [Name, Index] : Entries)
+		EntriesText += std::format("\t\t{{ \"{}\", 0x{:X} }},\n", PrefixQuotsWithBackslash(std::move(Name)), Index);
+
+	/* Pkg::UFoo -> Pkg_UFoo_Functions */
+	const std::string TableName = MakeGlobalIdentifier(StructName);
+
+	FunctionFile.Format(R"(
+// Functions of {0}, indexed by the id in their wrapper. Resolved together in a single pass over the class' 'Children' on first use.
+static class UFunction* {3}_Functions[0x{1:X}] = {{}};
+
+static class UFunction* {3}_ResolveFunction(int32 Index)
+{{
+	static constexpr BasicFilesImpleUtils::FFunctionTableEntry Entries[] = {{
+{2}	}};
+
+	BasicFilesImpleUtils::ResolveFunctionTable({0}::StaticClass(), Entries, 0x{1:X}, {3}_Functions);
+
+	return {3}_Functions[Index];
+}}
+
+)", StructName, Entries.size(), EntriesText, TableName);
+
+	return true;
+}
+
+std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	static PredefinedFunction StaticClass;
-	static PredefinedFunction StaticName;
-	static PredefinedFunction GetDefaultObj;
+	/* Bodies are modified per class, thread_local as packages are generated in parallel */
+	thread_local PredefinedFunction StaticClass;
+	thread_local PredefinedFunction StaticName;
+	thread_local PredefinedFunction GetDefaultObj;
 
-	static PredefinedFunction Interface_AsObject;
-	static PredefinedFunction Interface_AsObject_Const;
+	thread_local PredefinedFunction Interface_AsObject;
+	thread_local PredefinedFunction Interface_AsObject_Const;
 
 	if (StaticClass.NameWithParams.empty())
 		StaticClass = {
@@ -576,6 +860,9 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 
 	const bool bIsInterface = Struct.IsInterface();
 
+	const bool bHasFunctionTable = GenerateFunctionTable(Struct, Members, StructName, FunctionFile);
+	int32 NextFunctionTableIndex = 0x0;
+
 	for (const FunctionWrapper& Func : Members.IterateFunctions())
 	{
 		/* The function is no callable function, but instead just the signature of a TDelegate or TMulticastInlineDelegate */
@@ -598,7 +885,9 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 		bIsFirstIteration = false;
 		bDidSwitch = false;
 
-		InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile, AssertionFile);
+		const int32 FunctionTableIndex = bHasFunctionTable && !Func.IsPredefined() ? NextFunctionTableIndex++ : -1;
+
+		InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile, AssertionFile, FunctionTableIndex);
 	}
 
 	/* Skip predefined classes, all structs and classes which don't inherit from UObject (very rare). */
@@ -615,10 +904,7 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 	if ((bWasLastFuncStatic != StaticClass.bIsStatic || bWaslastFuncConst != StaticClass.bIsConst) && !bIsFirstIteration && !bDidSwitch)
 		InHeaderFunctionText += '\n';
 
-	static UEClass BPGeneratedClass = nullptr;
-	
-	if (BPGeneratedClass == nullptr)
-		BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
+	static const UEClass BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
 
 	const bool bIsBPStaticClass = Struct.IsAClassWithType(BPGeneratedClass);
 
@@ -627,12 +913,28 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 	std::string Name = bIsNameUnique ? Struct.GetRawName() : Struct.GetFullName();
 	std::string NameText = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, Name) : std::format("\"{}\"", Name);
 
+	/* Blueprint classes are loaded and unloaded at runtime, their indices are not worth hinting */
+	const bool bAddIndexHints = CppSettings::bAddObjectIndexHints && !bIsBPStaticClass;
+
+	const int32 ObjectIndexHint = Struct.GetUnrealStruct().GetIndex();
+	const int32 NameIndexHint = Struct.GetUnrealStruct().GetFName().GetCompIdx();
+
+	/* With outline numbers the number is part of the name-entry, the comparison-index already identifies the name */
+	const uint32 NameNumberHint = !Settings::Internal::bUseOutlineNumberName ? Struct.GetUnrealStruct().GetFName().GetNumber() : 0x0;
+
 	if (bIsBPStaticClass)
 	{
 		StaticClass.Body = std::format(
 			R"({{
 	BP_STATIC_CLASS_IMPL{}({})
 }})", (bIsNameUnique ? "" : "_FULLNAME"), NameText);
+	}
+	else if (bAddIndexHints)
+	{
+		StaticClass.Body = std::format(
+R"({{
+	STATIC_CLASS_IMPL{}_HINTED({}, 0x{:X}, 0x{:X}, 0x{:X})
+}})", (bIsNameUnique ? "" : "_FULLNAME"), NameText, ObjectIndexHint, NameIndexHint, NameNumberHint);
 	}
 	else
 	{
@@ -645,10 +947,20 @@ R"({{
 	/* ClassName always uses the short name, and it's a wide string for FString */
 	NameText = CppSettings::XORString ? std::format("{}(L\"{}\")", CppSettings::XORString, Struct.GetRawName()) : std::format("L\"{}\"", Struct.GetRawName());
 
-	StaticName.Body = std::format(
+	if (bAddIndexHints)
+	{
+		StaticName.Body = std::format(
+R"({{
+	STATIC_NAME_IMPL_HINTED({}, 0x{:X}, 0x{:X}, 0x{:X})
+}})", NameText, ObjectIndexHint, NameIndexHint, NameNumberHint);
+	}
+	else
+	{
+		StaticName.Body = std::format(
 R"({{
 	STATIC_NAME_IMPL({})
 }})", NameText);
+	}
 
 	/* Set class-specific parts of 'GetDefaultObj' */
 	GetDefaultObj.ReturnType = std::format("class {}*", StructName);
@@ -673,7 +985,7 @@ R"({{
 	return InHeaderFunctionText;
 }
 
-void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& StructFile, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile, int32 PackageIndex, const std::string& StructNameOverride)
+void CppGenerator::GenerateStruct(const StructWrapper& Struct, OutputBuffer& StructFile, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile, int32 PackageIndex, const std::string& StructNameOverride)
 {
 	if (!Struct.IsValid())
 		return;
@@ -717,7 +1029,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 	const bool bIsTemplatedType = Struct.HasCustomTemplateText();
 
 
-	StructFile << std::format(R"(
+	StructFile.Format(R"(
 // {}
 // 0x{:04X} (0x{:04X} - 0x{:04X})
 {}{}{} {}{}{}{}
@@ -746,7 +1058,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 
 	if (bHasMembers)
 	{
-		StructFile << GenerateMembers(Struct, Members, bIsReusingTrailingPaddingFromSuper ? UnalignedSuperSize : SuperSize, SuperLastMemberEnd, SuperAlignment, PackageIndex);
+		GenerateMembers(Struct, Members, StructFile, bIsReusingTrailingPaddingFromSuper ? UnalignedSuperSize : SuperSize, SuperLastMemberEnd, SuperAlignment, PackageIndex);
 
 		if (bHasFunctions)
 			StructFile << "\npublic:\n";
@@ -754,7 +1066,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 
 	if (bHasFunctions)
 	{
-		StreamType& FuncParamsAssertionFile = Settings::Debug::bGenerateAssertionFile ? AssertionFile : ParamFile;
+		OutputBuffer& FuncParamsAssertionFile = Settings::Debug::bGenerateAssertionFile ? AssertionFile : ParamFile;
 
 		StructFile << GenerateFunctions(Struct, Members, UniqueName, FunctionFile, ParamFile, FuncParamsAssertionFile);
 	}
@@ -788,10 +1100,10 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 		const int32 StructSize = Struct.GetSize();
 
 		// Alignment assertions
-		AssertionFile << std::format("static_assert(alignof({0}) == 0x{1:06X}, \"Wrong alignment on {0}\");{2}", UniqueName, Struct.GetAlignment(), AssertionNewLineStr);
+		AssertionFile.Format("static_assert(alignof({0}) == 0x{1:06X}, \"Wrong alignment on {0}\");{2}", UniqueName, Struct.GetAlignment(), AssertionNewLineStr);
 
 		// Size assertions
-		AssertionFile << std::format("static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");{}", UniqueName, (StructSize > 0x0 ? StructSize : 0x1), UniqueName, AssertionNewLineStr);
+		AssertionFile.Format("static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");{}", UniqueName, (StructSize > 0x0 ? StructSize : 0x1), UniqueName, AssertionNewLineStr);
 	}
 
 
@@ -802,7 +1114,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 			if (Member.IsBitField() || Member.IsZeroSizedMember() || Member.IsStatic())
 				continue;
 
-			AssertionFile << std::format("static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");{3}", UniqueName, Member.GetName(), Member.GetOffset(), AssertionNewLineStr);
+			AssertionFile.Format("static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");{3}", UniqueName, Member.GetName(), Member.GetOffset(), AssertionNewLineStr);
 		}
 	}
 
@@ -812,7 +1124,7 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 	}
 }
 
-void CppGenerator::GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile)
+void CppGenerator::GenerateEnum(const EnumWrapper& Enum, OutputBuffer& StructFile)
 {
 	if (!Enum.IsValid())
 		return;
@@ -831,7 +1143,7 @@ void CppGenerator::GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile)
 	if (!MemberString.empty()) [[likely]]
 		MemberString.pop_back();
 
-	StructFile << std::format(R"(
+	StructFile.Format(R"(
 // {}
 // NumValues: 0x{:04X}
 enum class {} : {}
@@ -843,6 +1155,62 @@ enum class {} : {}
   , GetEnumPrefixedName(Enum)
   , GetEnumUnderlayingType(Enum)
   , MemberString);
+
+	if constexpr (!Settings::CppGenerator::bGenerateNameTables)
+		return;
+
+	if (NumValues == 0x0)
+		return;
+
+	const std::string EnumName = GetEnumPrefixedName(Enum);
+
+	std::string CaseString;
+	std::unordered_set<uint64> WrittenValues;
+
+	std::vector<std::string> NameStorage;
+	std::vector<std::string> Values;
+
+	for (const EnumCollisionInfo& Info : Enum.GetMembers())
+	{
+		const std::string EnumValue = std::format("{}::{}", EnumName, Info.GetUniqueName());
+
+		/* Values shared by several names map to the first one */
+		if (WrittenValues.insert(Info.GetValue()).second)
+			CaseString += std::format("\tcase {}:\n\t\treturn \"{}\";\n", EnumValue, Info.GetUniqueName());
+
+		NameStorage.push_back(Info.GetUniqueName());
+		Values.push_back(EnumValue);
+	}
+
+	const std::vector<std::string_view> Names(NameStorage.begin(), NameStorage.end());
+
+	/* Pkg::EFoo -> Pkg_EFoo_NameTable */
+	const std::string TableName = MakeGlobalIdentifier(EnumName) + "_NameTable";
+
+	StructFile.Format(R"(
+constexpr const char* EnumToString({0} Value)
+{{
+	switch (Value)
+	{{
+{1}	default:
+		return nullptr;
+	}}
+}}
+
+{2}
+constexpr bool StringToEnum(std::string_view Name, {0}& OutValue)
+{{
+	const auto* Entry = {3}.Find(Name);
+
+	if (Entry)
+		OutValue = Entry->Value;
+
+	return Entry != nullptr;
+}}
+)", EnumName
+  , CaseString
+  , MakePerfectHashTableDefinition(TableName, EnumName, Names, Values)
+  , TableName);
 }
 
 std::string CppGenerator::GetStructPrefixedName(const StructWrapper& Struct)
@@ -896,14 +1264,8 @@ std::string CppGenerator::GetAssertionMacroString(const std::string& PrefixedStr
 
 std::string CppGenerator::GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance)
 {
-	static int32 UObjectSize = 0x0;
-	static int32 AActorSize = 0x0;
-
-	if (UObjectSize == 0x0 || AActorSize == 0x0)
-	{
-		UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
-		AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
-	}
+	static const int32 UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
+	static const int32 AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
 
 	/* Predefined structs can not be cyclic, unless you did something horribly wrong when defining the predefined struct! */
 	if (!Struct.IsUnrealStruct())
@@ -951,59 +1313,199 @@ std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIn
 	};
 
 	if (bAllowForConstPtrMembers && Member.HasPropertyFlags(EPropertyFlags::ConstParm) && IsMemberPtr(Member))
-		return "const " + GetMemberTypeStringWithoutConst(Member, PackageIndex);
+		return std::format("const {}", GetMemberTypeStringWithoutConst(Member, PackageIndex));
+
+	return std::string(GetMemberTypeStringWithoutConst(Member, PackageIndex));
+}
 
-	return GetMemberTypeStringWithoutConst(Member, PackageIndex);
+template<typename T>
+inline void AppendSignatureValue(std::string& Signature, T Value)
+{
+	Signature.append(reinterpret_cast<const char*>(&Value), sizeof(T));
 }
 
-std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex, bool* bOutIsUnknownProperty)
+/* Appends everything MakeMemberTypeString() depends on, mirroring its branches. Object- and struct-references are identified by their index. */
+void CppGenerator::AppendTypeSignature(std::string& Signature, UEProperty Member, int32 PackageIndex)
 {
 	auto [Class, FieldClass] = Member.GetClass();
 
 	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
 
-	if (Flags & EClassCastFlags::ByteProperty)
+	AppendSignatureValue(Signature, Flags);
+
+	auto AppendObjectIndex = [&Signature](UEObject Obj) -> void
 	{
-		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
-			return GetEnumPrefixedName(Enum);
+		AppendSignatureValue(Signature, Obj ? Obj.GetIndex() : -1);
+	};
 
-		return "uint8";
-	}
-	else if (Flags & EClassCastFlags::UInt16Property)
+	if (Flags & EClassCastFlags::ByteProperty)
 	{
-		return "uint16";
+		AppendObjectIndex(Member.Cast<UEByteProperty>().GetEnum());
 	}
-	else if (Flags & EClassCastFlags::UInt32Property)
+	else if (Flags & EClassCastFlags::ClassProperty)
 	{
-		return "uint32";
+		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
+			AppendObjectIndex(Member.Cast<UEClassProperty>().GetMetaClass());
 	}
-	else if (Flags & EClassCastFlags::UInt64Property)
+	else if (Flags & EClassCastFlags::BoolProperty)
 	{
-		return "uint64";
+		AppendSignatureValue(Signature, Member.Cast<UEBoolProperty>().IsNativeBool() ? 0x0 : Member.GetSize());
 	}
-	else if (Flags & EClassCastFlags::Int8Property)
+	else if (Flags & EClassCastFlags::StructProperty)
 	{
-		return "int8";
+		const StructWrapper UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
+
+		AppendObjectIndex(UnderlayingStruct.GetUnrealStruct());
+		AppendSignatureValue(Signature, UnderlayingStruct.IsCyclicWithPackage(PackageIndex));
 	}
-	else if (Flags & EClassCastFlags::Int16Property)
+	else if (Flags & EClassCastFlags::ArrayProperty)
 	{
-		return "int16";
+		AppendTypeSignature(Signature, Member.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex);
 	}
-	else if (Flags & EClassCastFlags::IntProperty)
+	else if (Flags & (EClassCastFlags::WeakObjectProperty | EClassCastFlags::LazyObjectProperty | EClassCastFlags::SoftClassProperty | EClassCastFlags::SoftObjectProperty
+		| EClassCastFlags::ObjectProperty | EClassCastFlags::ObjectPropertyBase | EClassCastFlags::InterfaceProperty))
 	{
-		return "int32";
+		AppendObjectIndex(Member.Cast<UEObjectProperty>().GetPropertyClass());
 	}
-	else if (Flags & EClassCastFlags::Int64Property)
+	else if (Flags & EClassCastFlags::MapProperty)
 	{
-		return "int64";
+		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
+
+		AppendTypeSignature(Signature, MemberAsMapProperty.GetKeyProperty(), PackageIndex);
+		AppendTypeSignature(Signature, MemberAsMapProperty.GetValueProperty(), PackageIndex);
 	}
-	else if (Flags & EClassCastFlags::FloatProperty)
+	else if (Flags & EClassCastFlags::SetProperty)
 	{
-		return "float";
+		AppendTypeSignature(Signature, Member.Cast<UESetProperty>().GetElementProperty(), PackageIndex);
 	}
-	else if (Flags & EClassCastFlags::DoubleProperty)
+	else if (Flags & EClassCastFlags::EnumProperty)
 	{
-		return "double";
+		UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum();
+
+		AppendObjectIndex(Enum);
+
+		if (!Enum)
+			AppendTypeSignature(Signature, Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
+	}
+	else if (Flags & EClassCastFlags::DelegateProperty)
+	{
+		AppendObjectIndex(Member.Cast<UEDelegateProperty>().GetSignatureFunction());
+	}
+	else if (Flags & EClassCastFlags::MulticastInlineDelegateProperty)
+	{
+		AppendObjectIndex(Member.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction());
+	}
+	else if (Flags & EClassCastFlags::FieldPathProperty)
+	{
+		if (Settings::Internal::bIsObjPtrInsteadOfFieldPathProperty)
+		{
+			AppendObjectIndex(Member.Cast<UEObjectProperty>().GetPropertyClass());
+		}
+		else
+		{
+			AppendSignatureValue(Signature, Member.Cast<UEFieldPathProperty>().GetFieldClass().GetAddress());
+		}
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
+
+		AppendSignatureValue(Signature, Member.GetSize() > ValueProperty.GetSize());
+		AppendTypeSignature(Signature, ValueProperty, PackageIndex);
+	}
+	else if (!(Flags & (EClassCastFlags::UInt16Property | EClassCastFlags::UInt32Property | EClassCastFlags::UInt64Property | EClassCastFlags::Int8Property
+		| EClassCastFlags::Int16Property | EClassCastFlags::IntProperty | EClassCastFlags::Int64Property | EClassCastFlags::FloatProperty | EClassCastFlags::DoubleProperty
+		| EClassCastFlags::NameProperty | EClassCastFlags::StrProperty | EClassCastFlags::TextProperty | EClassCastFlags::Utf8StrProperty | EClassCastFlags::AnsiStrProperty)))
+	{
+		/* Unknown property, the type-name is taken from its class */
+		AppendSignatureValue(Signature, Class ? Class.GetAddress() : FieldClass.GetAddress());
+	}
+}
+
+std::string_view CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex, bool* bOutIsUnknownProperty)
+{
+	/* Reused, only used while not recursing */
+	thread_local std::string Signature;
+
+	Signature.clear();
+	AppendTypeSignature(Signature, Member, PackageIndex);
+
+	{
+		std::shared_lock Lock(TypeStringCacheLock);
+
+		if (auto It = TypeStringCache.find(Signature); It != TypeStringCache.end()) [[likely]]
+		{
+			if (bOutIsUnknownProperty && It->second.bIsUnknownProperty)
+				*bOutIsUnknownProperty = true;
+
+			return It->second.Type;
+		}
+	}
+
+	/* Copy the signature, as MakeMemberTypeString() recurses into GetMemberTypeStringWithoutConst() for inner types */
+	std::string Key = Signature;
+
+	TypeStringEntry NewEntry;
+	NewEntry.bIsUnknownProperty = false;
+	NewEntry.Type = MakeMemberTypeString(Member, PackageIndex, &NewEntry.bIsUnknownProperty);
+
+	if (bOutIsUnknownProperty && NewEntry.bIsUnknownProperty)
+		*bOutIsUnknownProperty = true;
+
+	std::unique_lock Lock(TypeStringCacheLock);
+
+	/* Another thread might have inserted the same signature in the meantime, the entry is identical in that case. Nodes are never removed during generation. */
+	return TypeStringCache.try_emplace(std::move(Key), std::move(NewEntry)).first->second.Type;
+}
+
+std::string CppGenerator::MakeMemberTypeString(UEProperty Member, int32 PackageIndex, bool* bOutIsUnknownProperty)
+{
+	auto [Class, FieldClass] = Member.GetClass();
+
+	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+
+	if (Flags & EClassCastFlags::ByteProperty)
+	{
+		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
+			return GetEnumPrefixedName(Enum);
+
+		return "uint8";
+	}
+	else if (Flags & EClassCastFlags::UInt16Property)
+	{
+		return "uint16";
+	}
+	else if (Flags & EClassCastFlags::UInt32Property)
+	{
+		return "uint32";
+	}
+	else if (Flags & EClassCastFlags::UInt64Property)
+	{
+		return "uint64";
+	}
+	else if (Flags & EClassCastFlags::Int8Property)
+	{
+		return "int8";
+	}
+	else if (Flags & EClassCastFlags::Int16Property)
+	{
+		return "int16";
+	}
+	else if (Flags & EClassCastFlags::IntProperty)
+	{
+		return "int32";
+	}
+	else if (Flags & EClassCastFlags::Int64Property)
+	{
+		return "int64";
+	}
+	else if (Flags & EClassCastFlags::FloatProperty)
+	{
+		return "float";
+	}
+	else if (Flags & EClassCastFlags::DoubleProperty)
+	{
+		return "double";
 	}
 	else if (Flags & EClassCastFlags::ClassProperty)
 	{
@@ -1098,7 +1600,7 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
 			return GetEnumPrefixedName(Enum);
 
-		return GetMemberTypeStringWithoutConst(Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
+		return std::string(GetMemberTypeStringWithoutConst(Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex));
 	}
 	else if (Flags & EClassCastFlags::InterfaceProperty)
 	{
@@ -1230,17 +1732,17 @@ std::unordered_map<std::string, UEProperty> CppGenerator::GetUnknownProperties()
 		for (UEProperty Prop : Obj.Cast<UEStruct>().GetProperties())
 		{
 			bool bIsUnknownProperty = false;
-			const std::string TypeName = GetMemberTypeStringWithoutConst(Prop, -1, &bIsUnknownProperty);
+			const std::string_view TypeName = GetMemberTypeStringWithoutConst(Prop, -1, &bIsUnknownProperty);
 
 			if (bIsUnknownProperty)
-				PropertiesWithNames[TypeName] = Prop;
+				PropertiesWithNames[std::string(TypeName)] = Prop;
 		}
 	}
 
 	return PropertiesWithNames;
 }
 
-void CppGenerator::GeneratePropertyFixupFile(StreamType& PropertyFixup)
+void CppGenerator::GeneratePropertyFixupFile(OutputBuffer& PropertyFixup)
 {
 	WriteFileHead(PropertyFixup, nullptr, EFileType::PropertyFixup, "PROPERTY-FIXUP");
 
@@ -1248,13 +1750,13 @@ void CppGenerator::GeneratePropertyFixupFile(StreamType& PropertyFixup)
 
 	for (const auto& [Name, Property] : UnknownProperties)
 	{
-		PropertyFixup << std::format("\nclass alignas(0x{:02X}) {}\n{{\n\tunsigned __int8 Pad[0x{:X}];\n}};\n",Property.GetAlignment(), Name, Property.GetSize());
+		PropertyFixup.Format("\nclass alignas(0x{:02X}) {}\n{{\n\tunsigned __int8 Pad[0x{:X}];\n}};\n",Property.GetAlignment(), Name, Property.GetSize());
 	}
 
 	WriteFileEnd(PropertyFixup, EFileType::PropertyFixup);
 }
 
-void CppGenerator::GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile)
+void CppGenerator::GenerateEnumFwdDeclarations(OutputBuffer& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile)
 {
 	const std::vector<std::pair<int32, bool>>& FwdDeclarations = Package.GetEnumForwardDeclarations();
 
@@ -1265,30 +1767,46 @@ void CppGenerator::GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, Pa
 
 		EnumWrapper Enum = EnumWrapper(ObjectArray::GetByIndex<UEEnum>(EnumIndex));
 
-		ClassOrStructFile << std::format("enum class {} : {};\n", GetEnumPrefixedName(Enum), GetEnumUnderlayingType(Enum));
+		ClassOrStructFile.Format("enum class {} : {};\n", GetEnumPrefixedName(Enum), GetEnumUnderlayingType(Enum));
+	}
+}
+
+void CppGenerator::GenerateForwardDeclarationFile(OutputBuffer& FwdFile, PackageInfoHandle Package)
+{
+	WriteFileHead(FwdFile, Package, EFileType::ForwardDeclarations);
+
+	for (const int32 EnumIndex : Package.GetEnums())
+	{
+		EnumWrapper Enum = EnumWrapper(ObjectArray::GetByIndex<UEEnum>(EnumIndex));
+
+		/* Enums with colliding names are declared in their package-namespace in NameCollisions.inl */
+		if (!Enum.GetUniqueName().second)
+			continue;
+
+		FwdFile.Format("enum class {} : {};\n", GetEnumPrefixedName(Enum), GetEnumUnderlayingType(Enum));
 	}
+
+	WriteFileEnd(FwdFile, EFileType::ForwardDeclarations);
 }
 
-void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
+void CppGenerator::GenerateNameCollisionsInl(OutputBuffer& NameCollisionsFile)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
 	WriteFileHead(NameCollisionsFile, nullptr, EFileType::NameCollisionsInl, "FORWARD DECLARATIONS");
 
-	const StructManager::OverrideMapType& StructInfoMap = StructManager::GetStructInfos();
-	const EnumManager::OverrideMaptType& EnumInfoMap = EnumManager::GetEnumInfos();
+	const StructManager::StructInfoListType& StructInfos = StructManager::GetStructInfos();
+	const EnumManager::EnumInfoListType& EnumInfos = EnumManager::GetEnumInfos();
 
 	std::unordered_map<int32 /* PackageIdx */, std::pair<std::string, int32>> PackagesAndForwardDeclarations;
 
-	for (const auto& [Index, Info] : StructInfoMap)
+	/* StructInfos only contains structs and classes, functions are kept separately */
+	for (int32 i = 0; i < StructInfos.size(); i++)
 	{
-		if (StructManager::IsStructNameUnique(Info.Name))
+		if (StructManager::IsStructNameUnique(StructInfos[i].Name))
 			continue;
 
-		UEStruct Struct = ObjectArray::GetByIndex<UEStruct>(Index);
-
-		if (Struct.IsA(EClassCastFlags::Function))
-			continue;
+		UEStruct Struct = ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Struct));
 
 		auto& [ForwardDeclarations, Count] = PackagesAndForwardDeclarations[Struct.GetPackageIndex()];
 
@@ -1296,12 +1814,12 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 		Count++;
 	}
 
-	for (const auto& [Index, Info] : EnumInfoMap)
+	for (int32 i = 0; i < EnumInfos.size(); i++)
 	{
-		if (EnumManager::IsEnumNameUnique(Info))
+		if (EnumManager::IsEnumNameUnique(EnumInfos[i]))
 			continue;
 
-		UEEnum Enum = ObjectArray::GetByIndex<UEEnum>(Index);
+		UEEnum Enum = ObjectArray::GetByIndex<UEEnum>(DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Enum));
 
 		auto& [ForwardDeclarations, Count] = PackagesAndForwardDeclarations[Enum.GetPackageIndex()];
 
@@ -1322,7 +1840,7 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 
 		bHasSingleLineForwardDeclarations = true;
 
-		NameCollisionsFile << std::format("\nnamespace {} {{ {} }}\n", PackageName, ForwardDeclString.c_str() + 1);
+		NameCollisionsFile.Format("\nnamespace {} {{ {} }}\n", PackageName, ForwardDeclString.c_str() + 1);
 	}
 
 	if (bHasSingleLineForwardDeclarations)
@@ -1337,7 +1855,7 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 		if (ForwardDeclarations.second <= 1)
 			continue;
 
-		NameCollisionsFile << std::format(R"(
+		NameCollisionsFile.Format(R"(
 namespace {}
 {{
 {}
@@ -1348,23 +1866,23 @@ namespace {}
 	WriteFileEnd(NameCollisionsFile, EFileType::NameCollisionsInl);
 }
 
-void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
+void CppGenerator::GenerateDebugAssertions(OutputBuffer& AssertionStream)
 {
 	WriteFileHead(AssertionStream, nullptr, EFileType::DebugAssertions, "Debug assertions to verify member-offsets and struct-sizes");
 
-	auto GenerateAssertionsForStruct = [](StreamType& AssertionStream, const StructWrapper& Struct, const std::string& ParamStructName = "")
+	auto GenerateAssertionsForStruct = [](OutputBuffer& AssertionStream, const StructWrapper& Struct, const std::string& ParamStructName = "")
 	{
 		const std::string UniquePrefixedName = ParamStructName.empty() ? GetStructPrefixedName(Struct) : ParamStructName;
 
-		AssertionStream << std::format("\\\n/* {} {} */ \\\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
+		AssertionStream.Format("\\\n/* {} {} */ \\\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
 
 		// Alignment assertions
-		AssertionStream << std::format("static_assert(alignof({}) == 0x{:06X}); \\\n", UniquePrefixedName, Struct.GetAlignment());
+		AssertionStream.Format("static_assert(alignof({}) == 0x{:06X}); \\\n", UniquePrefixedName, Struct.GetAlignment());
 
 		const int32 StructSize = Struct.GetSize();
 
 		// Size assertions
-		AssertionStream << std::format("static_assert(sizeof({}) == 0x{:06X}); \\\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
+		AssertionStream.Format("static_assert(sizeof({}) == 0x{:06X}); \\\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
 
 		AssertionStream << "\\\n";
 
@@ -1376,7 +1894,7 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 			if (Member.IsStatic() || Member.IsZeroSizedMember() || Member.IsBitField())
 				continue;
 
-			AssertionStream << std::format("static_assert(offsetof({}, {}) == 0x{:06X}); \\\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
+			AssertionStream.Format("static_assert(offsetof({}, {}) == 0x{:06X}); \\\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
 		}
 
 		AssertionStream << "\\\n";
@@ -1411,7 +1929,7 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 		{
 			const DependencyManager& Structs = Package.GetSortedStructs();
 
-			AssertionStream << std::format("\n#define {}_STRUCTS_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
+			AssertionStream.Format("\n#define {}_STRUCTS_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
 
 			Structs.VisitAllNodesWithCallback(GenerateStructAssertionsCallback);
 		}
@@ -1420,10 +1938,10 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 		{
 			const DependencyManager& Classes = Package.GetSortedClasses();
 
-			AssertionStream << std::format("\n#define {}_CLASSES_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
+			AssertionStream.Format("\n#define {}_CLASSES_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
 			Classes.VisitAllNodesWithCallback(GenerateStructAssertionsCallback);
 
-			AssertionStream << std::format("\n#define {}_PARAMS_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
+			AssertionStream.Format("\n#define {}_PARAMS_{} \\\n", Settings::Debug::AssertionMacroPrefix, PackageName);
 			Classes.VisitAllNodesWithCallback(GenerateParamStructAssertionsCallback);
 		}
 	}
@@ -1431,32 +1949,106 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 	WriteFileEnd(AssertionStream, EFileType::DebugAssertions);
 }
 
-void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
+void CppGenerator::GenerateSDKHeader(OutputBuffer& SdkHpp)
 {
 	WriteFileHead(SdkHpp, nullptr, EFileType::SdkHpp, "Includes the entire SDK. Include files directly for faster compilation!");
 
 
-	auto ForEachElementCallback = [&SdkHpp](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	auto ForEachElementCallback = [&SdkHpp](const PackageManagerIterationParams& Params, bool bIsStruct) -> void
 	{
-		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(NewParams.RequiredPackage);
+		if (!ShouldGeneratePackage(Params.RequiredPackage))
+			return;
+
+		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(Params.RequiredPackage);
 
 		const bool bHasClassesFile = CurrentPackage.HasClasses();
 		const bool bHasStructsFile = (CurrentPackage.HasStructs() || CurrentPackage.HasEnums());
 
 		if (bIsStruct && bHasStructsFile)
-			SdkHpp << std::format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
+			SdkHpp.Format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
 
 		if (!bIsStruct && bHasClassesFile)
-			SdkHpp << std::format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
+			SdkHpp.Format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
 	};
 
 	PackageManager::IterateDependencies(ForEachElementCallback);
 
+	if constexpr (Settings::CppGenerator::bGenerateNameTables)
+		SdkHpp << "\n#include \"SDK/ClassNameTable.hpp\"\n";
+
 
 	WriteFileEnd(SdkHpp, EFileType::SdkHpp);
 }
 
-void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment, const std::string& CustomIncludes)
+void CppGenerator::GenerateClassNameTable(OutputBuffer& TableFile, const std::vector<PackageInfoHandle>& Packages)
+{
+	std::string Includes;
+
+	std::vector<std::string> NameStorage;
+	std::vector<std::string> Values;
+
+	/* Index into NameStorage, or -1 if classes in several packages share the name */
+	std::unordered_map<std::string, int32> NameIndices;
+
+	for (PackageInfoHandle Package : Packages)
+	{
+		if (!Package.HasClasses())
+			continue;
+
+		Includes += std::format("#include \"{}_classes.hpp\"\n", Settings::CppGenerator::FilePrefix + Package.GetName());
+
+		Package.GetSortedClasses().VisitAllNodesWithCallback([&](int32 Index) -> void
+		{
+			const StructWrapper Class(ObjectArray::GetByIndex<UEStruct>(Index));
+
+			/* Same condition as for the generation of 'StaticClass()' */
+			if (!Class.IsClass() || !Class.GetSuper().IsValid())
+				return;
+
+			std::string Name = Class.GetUnrealStruct().GetName();
+
+			auto [It, bWasInserted] = NameIndices.emplace(Name, static_cast<int32>(NameStorage.size()));
+
+			if (!bWasInserted)
+			{
+				It->second = -1;
+				return;
+			}
+
+			NameStorage.push_back(std::move(Name));
+			Values.push_back(std::format("&{}::StaticClass", GetStructPrefixedName(Class)));
+		});
+	}
+
+	std::vector<std::string_view> Names;
+	std::vector<std::string> UniqueValues;
+
+	for (int32 i = 0; i < NameStorage.size(); i++)
+	{
+		if (NameIndices[NameStorage[i]] < 0)
+			continue;
+
+		Names.push_back(NameStorage[i]);
+		UniqueValues.push_back(std::move(Values[i]));
+	}
+
+	WriteFileHead(TableFile, nullptr, EFileType::ClassNameTable, "Perfect-hash table of class-names to their 'StaticClass()' functions", Includes);
+
+	if (!Names.empty())
+		TableFile << MakePerfectHashTableDefinition("ClassNameTable", "class UClass*(*)()", Names, UniqueValues);
+
+	TableFile.Format(R"(
+/* Class by its name, without prefix. Returns nullptr for unknown names, and names shared by classes in several packages. */
+inline class UClass* StaticClassByName(std::string_view Name)
+{{
+	{}
+}}
+)", Names.empty() ? "return nullptr;" : "const auto* Entry = ClassNameTable.Find(Name);\n\n\treturn Entry ? Entry->Value() : nullptr;");
+
+	WriteFileEnd(TableFile, EFileType::ClassNameTable);
+}
+
+void CppGenerator::WriteFileHead(OutputBuffer& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment, const std::string& CustomIncludes)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
@@ -1473,19 +2065,20 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 )";
 
 	if (Type == EFileType::SdkHpp)
-		File << std::format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
+		File.Format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
 	
 
-	File << std::format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
+	File.Format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
 
 
 	if (!CustomIncludes.empty())
 		File << CustomIncludes + "\n";
 
-	if (Type != EFileType::BasicHpp && Type != EFileType::NameCollisionsInl && Type != EFileType::PropertyFixup && Type != EFileType::SdkHpp && Type != EFileType::DebugAssertions && Type != EFileType::UnrealContainers && Type != EFileType::UnicodeLib)
+	if (Type != EFileType::BasicHpp && Type != EFileType::NameCollisionsInl && Type != EFileType::PropertyFixup && Type != EFileType::SdkHpp && Type != EFileType::DebugAssertions && Type != EFileType::UnrealContainers && Type != EFileType::UnicodeLib
+		&& Type != EFileType::PrecompiledHeader && Type != EFileType::UnityBuild)
 		File << "#include \"Basic.hpp\"\n";
 
-	if (Type == EFileType::SdkHpp)
+	if (Type == EFileType::SdkHpp || Type == EFileType::PrecompiledHeader)
 		File << "#include \"SDK/Basic.hpp\"\n";
 
 	if (Type == EFileType::BasicHpp)
@@ -1500,7 +2093,7 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 
 		if constexpr (Settings::CppGenerator::XORStringInclude)
 		{
-			File << std::format("#include \"{}\"\n", Settings::CppGenerator::XORStringInclude);
+			File.Format("#include \"{}\"\n", Settings::CppGenerator::XORStringInclude);
 		}
 	}
 
@@ -1518,19 +2111,20 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 		File << "\n";
 
 		if (Package.HasClasses())
-			File << std::format("#include \"{}_classes.hpp\"\n", PackageName);
+			File.Format("#include \"{}_classes.hpp\"\n", PackageName);
 
 		if (Package.HasParameterStructs())
-			File << std::format("#include \"{}_parameters.hpp\"\n", PackageName);
+			File.Format("#include \"{}_parameters.hpp\"\n", PackageName);
 
 		File << "\n";
 	}
-	else if (Package.IsValidHandle())
+	else if (Package.IsValidHandle() && Type != EFileType::ForwardDeclarations)
 	{
 		File << "\n";
 
 		const DependencyInfo& Dep = Package.GetPackageDependencies();
 		const DependencyListType& CurrentDependencyList = Type == EFileType::Structs ? Dep.StructsDependencies : (Type == EFileType::Classes ? Dep.ClassesDependencies : Dep.ParametersDependencies);
+		const ForwardDeclarationListType& CurrentForwardDeclarationList = Type == EFileType::Structs ? Dep.StructsForwardDeclarations : (Type == EFileType::Classes ? Dep.ClassesForwardDeclarations : Dep.ParametersForwardDeclarations);
 
 		bool bAddNewLine = false;
 
@@ -1541,17 +2135,30 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 			std::string DependencyName = PackageManager::GetName(PackageIndex);
 
 			if (Requirements.bShouldIncludeStructs)
-				File << std::format("#include \"{}_structs.hpp\"\n", DependencyName);
+				File.Format("#include \"{}_structs.hpp\"\n", DependencyName);
 
 			if (Requirements.bShouldIncludeClasses)
-				File << std::format("#include \"{}_classes.hpp\"\n", DependencyName);
+				File.Format("#include \"{}_classes.hpp\"\n", DependencyName);
+		}
+
+		/* Only enums are used from these packages, their opaque declarations are enough */
+		for (const int32 PackageIndex : CurrentForwardDeclarationList)
+		{
+			auto It = CurrentDependencyList.find(PackageIndex);
+
+			if (It != CurrentDependencyList.end() && It->second.bShouldIncludeStructs)
+				continue;
+
+			bAddNewLine = true;
+
+			File.Format("#include \"{}_fwd.hpp\"\n", PackageManager::GetName(PackageIndex));
 		}
 
 		if (bAddNewLine)
 			File << "\n";
 	}
 
-	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib)
+	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib || Type == EFileType::PrecompiledHeader || Type == EFileType::UnityBuild)
 		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
 
 
@@ -1564,25 +2171,25 @@ void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EF
 
 	if (!Settings::Config::SDKNamespaceName.empty())
 	{
-		File << std::format("namespace {}", Settings::Config::SDKNamespaceName);
+		File.Format("namespace {}", Settings::Config::SDKNamespaceName);
 
 		if (Type == EFileType::Parameters && CppSettings::ParamNamespaceName)
-			File << std::format("::{}", CppSettings::ParamNamespaceName);
+			File.Format("::{}", CppSettings::ParamNamespaceName);
 
 		File << "\n{\n";
 	}
 	else if constexpr (CppSettings::ParamNamespaceName)
 	{
 		if (Type == EFileType::Parameters)
-			File << std::format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
+			File.Format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
 	}
 }
 
-void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
+void CppGenerator::WriteFileEnd(OutputBuffer& File, EFileType Type)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib)
+	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib || Type == EFileType::PrecompiledHeader || Type == EFileType::UnityBuild)
 		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
 
 	if (!Settings::Config::SDKNamespaceName.empty() || CppSettings::ParamNamespaceName)
@@ -1601,7 +2208,7 @@ void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
 
 void CppGenerator::GenerateVTHookFile()
 {
-	StreamType VTHookFile(MainFolder / "VTHook.hpp");
+	OutputBuffer VTHookFile;
 
 	VTHookFile << "\xEF\xBB\xBF";
 	VTHookFile << R"(#pragma once
@@ -1620,7 +2227,7 @@ void CppGenerator::GenerateVTHookFile()
 )";
 
 	if (!Settings::Config::SDKNamespaceName.empty())
-		VTHookFile << std::format("namespace {}\n{{\n\n", Settings::Config::SDKNamespaceName);
+		VTHookFile.Format("namespace {}\n{{\n\n", Settings::Config::SDKNamespaceName);
 
 	// SetVirtualFunction - write counterpart to GetVirtualFunction
 	VTHookFile << R"(namespace InSDKUtils
@@ -1767,6 +2374,8 @@ public:
 
 	if (!Settings::Config::SDKNamespaceName.empty())
 		VTHookFile << "}\n";
+
+	VTHookFile.WriteToFile(MainFolder / "VTHook.hpp");
 }
 
 void CppGenerator::GenerateVSProject(const std::vector<std::string>& AllHppFiles, const std::vector<std::string>& AllCppFiles)
@@ -1844,16 +2453,18 @@ void CppGenerator::GenerateVSProject(const std::vector<std::string>& AllHppFiles
 
 	// -- Inject/.slnx --
 	{
-		StreamType Slnx(InjectDir / (GameName + "_Inject.slnx"));
+		OutputBuffer Slnx;
 		Slnx << R"(<Solution>
   <Project Path=")" << GameName << R"(_Inject.vcxproj" />
 </Solution>
 )";
+
+		Slnx.WriteToFile(InjectDir / (GameName + "_Inject.slnx"));
 	}
 
 	// -- Inject/Main.cpp --
 	{
-		StreamType MainCpp(InjectDir / "Main.cpp");
+		OutputBuffer MainCpp;
 
 		// Includes
 		MainCpp << R"(#include <Windows.h>
@@ -1973,6 +2584,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 	return TRUE;
 }
 )";
+
+		MainCpp.WriteToFile(InjectDir / "Main.cpp");
 	}
 
 	// ================================================================
@@ -1981,16 +2594,18 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 
 	// -- Proxy/.slnx --
 	{
-		StreamType Slnx(ProxyDir / (GameName + "_Proxy.slnx"));
+		OutputBuffer Slnx;
 		Slnx << R"(<Solution>
   <Project Path=")" << GameName << R"(_Proxy.vcxproj" />
 </Solution>
 )";
+
+		Slnx.WriteToFile(ProxyDir / (GameName + "_Proxy.slnx"));
 	}
 
 	// -- Proxy/Main.cpp --
 	{
-		StreamType ProxyCpp(ProxyDir / "Main.cpp");
+		OutputBuffer ProxyCpp;
 
 		// Part 1: Includes and version.dll export forwarding
 		ProxyCpp << R"(#include <Windows.h>
@@ -2274,13 +2889,21 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 	return TRUE;
 }
 )";
+
+		ProxyCpp.WriteToFile(ProxyDir / "Main.cpp");
 	}
 
+	// Unity builds force-include the precompiled header into every file, SDK_pch.cpp overrides this with 'Create'
+	constexpr const char* PrecompiledHeaderSettings = R"(      <PrecompiledHeader>Use</PrecompiledHeader>
+      <PrecompiledHeaderFile>SDK_pch.hpp</PrecompiledHeaderFile>
+      <ForcedIncludeFiles>SDK_pch.hpp;%(ForcedIncludeFiles)</ForcedIncludeFiles>
+)";
+
 	// -- Helper: Write .vcxproj for a project subdirectory --
 	// Both projects reference shared SDK files via ..\ relative paths
 	auto WriteVcxproj = [&](const fs::path& Dir, const std::string& ProjName, const std::string& Guid, const std::string& TargetNameOverride)
 	{
-		StreamType Vcxproj(Dir / (ProjName + ".vcxproj"));
+		OutputBuffer Vcxproj;
 
 		Vcxproj << R"(<?xml version="1.0" encoding="utf-8"?>
 <Project DefaultTargets="Build" xmlns="http://schemas.microsoft.com/developer/msbuild/2003">
@@ -2339,7 +2962,12 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
       <PreprocessorDefinitions>NDEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>
       <AdditionalIncludeDirectories>..;%(AdditionalIncludeDirectories)</AdditionalIncludeDirectories>
       <RuntimeLibrary>MultiThreadedDLL</RuntimeLibrary>
-    </ClCompile>
+)";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+			Vcxproj << PrecompiledHeaderSettings;
+
+		Vcxproj << R"(    </ClCompile>
   </ItemDefinitionGroup>
 
   <ItemDefinitionGroup Condition="'$(Configuration)|$(Platform)'=='Debug|x64'">
@@ -2349,7 +2977,12 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
       <PreprocessorDefinitions>NDEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>
       <AdditionalIncludeDirectories>..;%(AdditionalIncludeDirectories)</AdditionalIncludeDirectories>
       <RuntimeLibrary>MultiThreadedDLL</RuntimeLibrary>
-    </ClCompile>
+)";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+			Vcxproj << PrecompiledHeaderSettings;
+
+		Vcxproj << R"(    </ClCompile>
   </ItemDefinitionGroup>
 
 )";
@@ -2357,14 +2990,32 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 		// ClCompile items
 		Vcxproj << "  <ItemGroup>\n";
 		Vcxproj << "    <ClCompile Include=\"Main.cpp\" />\n";
-		Vcxproj << "    <ClCompile Include=\"..\\SDK\\Basic.cpp\" />\n";
-		Vcxproj << "    <ClCompile Include=\"..\\SDK\\CoreUObject_functions.cpp\" />\n";
-		Vcxproj << "    <ClCompile Include=\"..\\SDK\\Engine_functions.cpp\" />\n";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+		{
+			Vcxproj << "    <ClCompile Include=\"..\\SDK_pch.cpp\">\n";
+			Vcxproj << "      <PrecompiledHeader>Create</PrecompiledHeader>\n";
+			Vcxproj << "    </ClCompile>\n";
+
+			for (const std::string& CppFile : AllCppFiles)
+				Vcxproj.Format("    <ClCompile Include=\"..\\SDK\\{}\" />\n", XmlEscape(CppFile));
+		}
+		else
+		{
+			Vcxproj << "    <ClCompile Include=\"..\\SDK\\Basic.cpp\" />\n";
+			Vcxproj << "    <ClCompile Include=\"..\\SDK\\CoreUObject_functions.cpp\" />\n";
+			Vcxproj << "    <ClCompile Include=\"..\\SDK\\Engine_functions.cpp\" />\n";
+		}
+
 		Vcxproj << "  </ItemGroup>\n\n";
 
 		// ClInclude items
 		Vcxproj << "  <ItemGroup>\n";
 		Vcxproj << "    <ClInclude Include=\"..\\VTHook.hpp\" />\n";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+			Vcxproj << "    <ClInclude Include=\"..\\SDK_pch.hpp\" />\n";
+
 		Vcxproj << "  </ItemGroup>\n\n";
 
 		Vcxproj << R"(  <Import Project="$(VCTargetsPath)\Microsoft.Cpp.targets" />
@@ -2372,8 +3023,10 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 </Project>
 )";
 
+		Vcxproj.WriteToFile(Dir / (ProjName + ".vcxproj"));
+
 		// Generate .vcxproj.filters to organize files into folders in Solution Explorer
-		StreamType Filters(Dir / (ProjName + ".vcxproj.filters"));
+		OutputBuffer Filters;
 
 		Filters << R"(<?xml version="1.0" encoding="utf-8"?>
 <Project ToolsVersion="4.0" xmlns="http://schemas.microsoft.com/developer/msbuild/2003">
@@ -2386,7 +3039,18 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 
   <ItemGroup>
     <ClCompile Include="Main.cpp" />
-    <ClCompile Include="..\SDK\Basic.cpp">
+)";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+		{
+			Filters << "    <ClCompile Include=\"..\\SDK_pch.cpp\">\n      <Filter>SDK</Filter>\n    </ClCompile>\n";
+
+			for (const std::string& CppFile : AllCppFiles)
+				Filters.Format("    <ClCompile Include=\"..\\SDK\\{}\">\n      <Filter>SDK</Filter>\n    </ClCompile>\n", XmlEscape(CppFile));
+		}
+		else
+		{
+			Filters << R"(    <ClCompile Include="..\SDK\Basic.cpp">
       <Filter>SDK</Filter>
     </ClCompile>
     <ClCompile Include="..\SDK\CoreUObject_functions.cpp">
@@ -2395,16 +3059,26 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
     <ClCompile Include="..\SDK\Engine_functions.cpp">
       <Filter>SDK</Filter>
     </ClCompile>
-  </ItemGroup>
+)";
+		}
+
+		Filters << R"(  </ItemGroup>
 
   <ItemGroup>
     <ClInclude Include="..\VTHook.hpp">
       <Filter>SDK</Filter>
     </ClInclude>
-  </ItemGroup>
+)";
+
+		if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+			Filters << "    <ClInclude Include=\"..\\SDK_pch.hpp\">\n      <Filter>SDK</Filter>\n    </ClInclude>\n";
+
+		Filters << R"(  </ItemGroup>
 
 </Project>
 )";
+
+		Filters.WriteToFile(Dir / (ProjName + ".vcxproj.filters"));
 	};
 
 	// Generate both projects
@@ -2412,176 +3086,447 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 	WriteVcxproj(ProxyDir, GameName + "_Proxy", ProxyGuid, "version");
 }
 
-void CppGenerator::Generate()
+void CppGenerator::GeneratePackage(PackageInfoHandle Package, OutputBuffer& AssertionFile, std::vector<SourceFileInfo>& OutFunctionFiles)
 {
-	// Generate SDK.hpp with sorted packages
-	StreamType SdkHpp(MainFolder / "SDK.hpp");
-	GenerateSDKHeader(SdkHpp);
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
 
-	// Generate PropertyFixup.hpp
-	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
-	GeneratePropertyFixupFile(PropertyFixup);
-
-	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
-	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
-	GenerateNameCollisionsInl(NameCollisionsInl);
-
-	// Generate UnrealContainers.hpp
-	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
-	GenerateUnrealContainers(UnrealContainers);
+	OutputBuffer ClassesFile;
+	OutputBuffer StructsFile;
+	OutputBuffer ParametersFile;
+	OutputBuffer FunctionsFile;
 
-	// Generate UtfN.hpp
-	StreamType UnicodeLib(MainFolder / "UtfN.hpp");
-	GenerateUnicodeLib(UnicodeLib);
+	/* Handles namespaces and includes, files are only written if the package contains something that goes into them */
+	if (Package.HasClasses())
+	{
+		WriteFileHead(ClassesFile, Package, EFileType::Classes);
 
-	StreamType DebugAssertions;
+		/* Write enum foward declarations before all of the classes */
+		GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+	}
 
-	if constexpr (Settings::Debug::bGenerateAssertionFile)
+	if (Package.HasStructs() || Package.HasEnums())
 	{
-		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
-		DebugAssertions.open(MainFolder / "Assertions.inl");
-		WriteFileHead(DebugAssertions, nullptr, EFileType::DebugAssertions, "Debug assertions to verify member-offsets and struct-sizes");
+		WriteFileHead(StructsFile, Package, EFileType::Structs);
 
-		//GenerateDebugAssertions(DebugAssertions);
+		/* Write enum foward declarations before all of the structs */
+		GenerateEnumFwdDeclarations(StructsFile, Package, false);
 	}
 
-	// Generate Basic.hpp and Basic.cpp files
-	StreamType BasicHpp(Subfolder / "Basic.hpp");
-	StreamType BasicCpp(Subfolder / "Basic.cpp");
-	GenerateBasicFiles(BasicHpp, BasicCpp, (Settings::Debug::bGenerateAssertionFile ? DebugAssertions : BasicHpp));
+	if (Package.HasParameterStructs())
+		WriteFileHead(ParametersFile, Package, EFileType::Parameters);
 
+	if (Package.HasFunctions())
+		WriteFileHead(FunctionsFile, Package, EFileType::Functions);
 
-	// File lists for VS project generation
-	std::vector<std::string> AllHppFiles;
-	std::vector<std::string> AllCppFiles;
+	/* Offsets after the functions of each struct, at which FunctionsFile can be split into parts */
+	const size_t FunctionsHeadSize = FunctionsFile.Size();
+	std::vector<size_t> FunctionsSplitOffsets;
 
-	AllHppFiles.push_back("Basic.hpp");
-	AllCppFiles.push_back("Basic.cpp");
+	const int32 PackageIndex = Package.GetIndex();
 
-	// Generates all packages and writes them to files
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	/* 
+	* Generate classes/structs/enums/functions into the respective buffers
+	* 
+	* Note: Some buffers are passed as parameters without being written to a file afterwards, because the function demands it
+	*/
+	for (int32 EnumIdx : Package.GetEnums())
 	{
-		if (Package.IsEmpty())
-			continue;
+		GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+	}
 
-		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
-		const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
 
-		StreamType ClassesFile;
-		StreamType StructsFile;
-		StreamType ParametersFile;
-		StreamType FunctionsFile;
+		OutputBuffer& FileForAssertions = Settings::Debug::bGenerateAssertionFile ? AssertionFile : StructsFile;
 
-		/* Create files and handles namespaces and includes */
-		if (Package.HasClasses())
+		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
 		{
-			ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, FileForAssertions, PackageIndex);
 
-			if (!ClassesFile.is_open())
-				std::cerr << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+			FunctionsSplitOffsets.push_back(FunctionsFile.Size());
+		};
 
-			WriteFileHead(ClassesFile, Package, EFileType::Classes);
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
 
-			/* Write enum foward declarations before all of the classes */
-			GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
 
-			AllHppFiles.push_back(FileName + "_classes.hpp");
-		}
+		OutputBuffer& FileForAssertions = Settings::Debug::bGenerateAssertionFile ? AssertionFile : ClassesFile;
 
-		if (Package.HasStructs() || Package.HasEnums())
+		DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
 		{
-			StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, FileForAssertions, PackageIndex);
 
-			if (!StructsFile.is_open())
-				std::cerr << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
-
-			WriteFileHead(StructsFile, Package, EFileType::Structs);
+			FunctionsSplitOffsets.push_back(FunctionsFile.Size());
+		};
 
-			/* Write enum foward declarations before all of the structs */
-			GenerateEnumFwdDeclarations(StructsFile, Package, false);
+		Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	}
 
-			AllHppFiles.push_back(FileName + "_structs.hpp");
-		}
 
-		if (Package.HasParameterStructs())
-		{
-			ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+	/* Closes any namespaces if required */
+	if (Package.HasClasses())
+		WriteFileEnd(ClassesFile, EFileType::Classes);
 
-			if (!ParametersFile.is_open())
-				std::cerr << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+	if (Package.HasStructs() || Package.HasEnums())
+		WriteFileEnd(StructsFile, EFileType::Structs);
 
-			WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+	if (Package.HasParameterStructs())
+		WriteFileEnd(ParametersFile, EFileType::Parameters);
 
-			AllHppFiles.push_back(FileName + "_parameters.hpp");
-		}
+	const size_t FunctionsBodyEnd = FunctionsFile.Size();
 
-		if (Package.HasFunctions())
-		{
-			FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+	if (Package.HasFunctions())
+		WriteFileEnd(FunctionsFile, EFileType::Functions);
 
-			if (!FunctionsFile.is_open())
-				std::cerr << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+	auto WritePackageFile = [&](const OutputBuffer& Buffer, const char8_t* FileSuffix) -> void
+	{
+		if (!Buffer.WriteToFile(Subfolder / (U8FileName + FileSuffix)))
+			std::cerr << std::format("Error opening file \"{}\"\n", FileName + reinterpret_cast<const char*>(FileSuffix));
+	};
 
-			WriteFileHead(FunctionsFile, Package, EFileType::Functions);
+	if (Package.HasClasses())
+		WritePackageFile(ClassesFile, u8"_classes.hpp");
 
-			AllCppFiles.push_back(FileName + "_functions.cpp");
-		}
+	if (Package.HasStructs() || Package.HasEnums())
+		WritePackageFile(StructsFile, u8"_structs.hpp");
 
-		const int32 PackageIndex = Package.GetIndex();
+	if (Package.HasParameterStructs())
+		WritePackageFile(ParametersFile, u8"_parameters.hpp");
 
-		/* 
-		* Generate classes/structs/enums/functions directly into the respective files
-		* 
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
+	if constexpr (Settings::CppGenerator::bGenerateForwardDeclarationHeaders)
+	{
+		if (Package.HasEnums())
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+			OutputBuffer FwdFile(0x1000);
+			GenerateForwardDeclarationFile(FwdFile, Package);
+
+			WritePackageFile(FwdFile, u8"_fwd.hpp");
 		}
+	}
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+	if (!Package.HasFunctions())
+		return;
 
-			StreamType& FileForAssertions = Settings::Debug::bGenerateAssertionFile ? DebugAssertions : StructsFile;
+	if (!Settings::CppGenerator::bGenerateUnityBuild || FunctionsFile.Size() <= Settings::CppGenerator::MaxFunctionsFileSize)
+	{
+		WritePackageFile(FunctionsFile, u8"_functions.cpp");
+		OutFunctionFiles.push_back({ FileName + "_functions.cpp", FunctionsFile.Size() });
 
-			DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, FileForAssertions, PackageIndex);
-			};
+		return;
+	}
 
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	/* Every part gets the includes and namespace of the original file */
+	const std::string_view FunctionsView = FunctionsFile.View();
+	const std::string_view FunctionsHead = FunctionsView.substr(0x0, FunctionsHeadSize);
+	const std::string_view FunctionsEnd = FunctionsView.substr(FunctionsBodyEnd);
 
-		if (Package.HasClasses())
+	int32 PartIndex = 0x0;
+
+	auto WriteFunctionsPart = [&](size_t Begin, size_t End) -> void
+	{
+		OutputBuffer Part(FunctionsHead.size() + (End - Begin) + FunctionsEnd.size());
+		Part << FunctionsHead << FunctionsView.substr(Begin, End - Begin) << FunctionsEnd;
+
+		const std::string PartSuffix = std::format("_functions_part{}.cpp", PartIndex++);
+		WritePackageFile(Part, reinterpret_cast<const char8_t*>(PartSuffix.c_str()));
+
+		OutFunctionFiles.push_back({ FileName + PartSuffix, Part.Size() });
+	};
+
+	FunctionsSplitOffsets.push_back(FunctionsBodyEnd);
+
+	size_t PartBegin = FunctionsHeadSize;
+	size_t LastSplitOffset = FunctionsHeadSize;
+
+	for (const size_t Offset : FunctionsSplitOffsets)
+	{
+		/* A single struct larger than MaxFunctionsFileSize still gets a part of its own */
+		if ((Offset - PartBegin) > Settings::CppGenerator::MaxFunctionsFileSize && LastSplitOffset > PartBegin)
 		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+			WriteFunctionsPart(PartBegin, LastSplitOffset);
+			PartBegin = LastSplitOffset;
+		}
 
-			StreamType& FileForAssertions = Settings::Debug::bGenerateAssertionFile ? DebugAssertions : ClassesFile;
+		LastSplitOffset = Offset;
+	}
 
-			DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, FileForAssertions, PackageIndex);
-			};
+	WriteFunctionsPart(PartBegin, FunctionsBodyEnd);
+}
+
+void CppGenerator::GenerateUnityBuildFiles(const std::vector<SourceFileInfo>& FunctionFiles, std::vector<std::string>& OutCppFiles)
+{
+	OutputBuffer PchHpp;
+	WriteFileHead(PchHpp, nullptr, EFileType::PrecompiledHeader, "Precompiled header of the SDK, force-included into every file of the generated projects", "#include <Windows.h>\n#include <iostream>");
+	PchHpp.Format("#include \"SDK/{}CoreUObject_classes.hpp\"\n", Settings::CppGenerator::FilePrefix);
+	PchHpp.Format("#include \"SDK/{}Engine_classes.hpp\"\n", Settings::CppGenerator::FilePrefix);
+	PchHpp.WriteToFile(MainFolder / "SDK_pch.hpp");
+
+	OutputBuffer PchCpp;
+	PchCpp << "#include \"SDK_pch.hpp\"\n";
+	PchCpp.WriteToFile(MainFolder / "SDK_pch.cpp");
+
+	const size_t NumUnityFiles = std::min<size_t>(Settings::CppGenerator::NumUnityBuildFiles, FunctionFiles.size());
+
+	if (NumUnityFiles == 0x0)
+		return;
+
+	/* Largest files first, each goes to the currently smallest unity file */
+	std::vector<int32> FilesBySize(FunctionFiles.size());
+	std::iota(FilesBySize.begin(), FilesBySize.end(), 0x0);
+
+	std::stable_sort(FilesBySize.begin(), FilesBySize.end(), [&](int32 Left, int32 Right) -> bool
+	{
+		return FunctionFiles[Left].Size > FunctionFiles[Right].Size;
+	});
+
+	std::vector<std::vector<int32>> UnityFileContents(NumUnityFiles);
+	std::vector<size_t> UnityFileSizes(NumUnityFiles, 0x0);
 
-			Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	for (const int32 FileIndex : FilesBySize)
+	{
+		const size_t SmallestUnityFile = std::min_element(UnityFileSizes.begin(), UnityFileSizes.end()) - UnityFileSizes.begin();
+
+		UnityFileContents[SmallestUnityFile].push_back(FileIndex);
+		UnityFileSizes[SmallestUnityFile] += FunctionFiles[FileIndex].Size;
+	}
+
+	for (size_t i = 0; i < NumUnityFiles; i++)
+	{
+		std::vector<int32>& Contents = UnityFileContents[i];
+
+		/* Keep package-order inside of a unity file, so the output doesn't depend on the file sizes more than it has to */
+		std::sort(Contents.begin(), Contents.end());
+
+		const std::string UnityFileName = std::format("Unity_{}.cpp", i);
+
+		OutputBuffer UnityFile;
+		WriteFileHead(UnityFile, nullptr, EFileType::UnityBuild, "Unity build file, compiles multiple '_functions.cpp' files in a single translation unit");
+
+		for (const int32 FileIndex : Contents)
+			UnityFile.Format("#include \"{}\"\n", FunctionFiles[FileIndex].FileName);
+
+		UnityFile.WriteToFile(Subfolder / UnityFileName);
+
+		OutCppFiles.push_back(UnityFileName);
+	}
+
+	const size_t TotalSize = std::accumulate(UnityFileSizes.begin(), UnityFileSizes.end(), size_t(0x0));
+	const size_t LargestSize = *std::max_element(UnityFileSizes.begin(), UnityFileSizes.end());
+
+	/* Only the layout is known at generation time, compile times depend on the compiler and machine */
+	std::cerr << std::format("Unity build layout (source sizes): {} '_functions.cpp' files ({} KiB) in {} translation units, largest: {} KiB, average: {} KiB.\n",
+		FunctionFiles.size(), TotalSize / 0x400, NumUnityFiles, LargestSize / 0x400, (TotalSize / NumUnityFiles) / 0x400);
+}
+
+void CppGenerator::InitPartialSDK()
+{
+	PartialSDKPackages.clear();
+	PartialSDKForwardDeclaredPackages.clear();
+
+	if (Settings::Config::SDKRootSet.empty())
+		return;
+
+	/* Required by the predefined members and functions in Basic.hpp/Basic.cpp */
+	std::vector<int32> RootPackages = {
+		ObjectArray::FindClassFast("Object").GetPackageIndex(),
+		ObjectArray::FindClassFast("Actor").GetPackageIndex(),
+	};
+
+	for (const std::string& RootName : Settings::Config::SDKRootSet)
+	{
+		UEStruct RootStruct = ObjectArray::FindStructFast(RootName);
+
+		/* Allow names with their C++ prefix, eg. 'APlayerController' */
+		if (!RootStruct && RootName.size() > 1)
+			RootStruct = ObjectArray::FindStructFast(RootName.substr(1));
+
+		if (RootStruct)
+		{
+			RootPackages.push_back(RootStruct.GetPackageIndex());
+			continue;
+		}
+
+		bool bFoundPackage = false;
+
+		for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+		{
+			if (Package.GetName() != RootName)
+				continue;
+
+			RootPackages.push_back(Package.GetIndex());
+			bFoundPackage = true;
 		}
 
+		if (!bFoundPackage)
+			std::cerr << std::format("SDKRootSet: \"{}\" is neither a class, struct nor package, ignoring it.\n", RootName);
+	}
+
+	PackageManager::GetRequiredPackages(RootPackages, PartialSDKPackages, PartialSDKForwardDeclaredPackages);
+
+	std::cerr << std::format("Generating partial SDK with {} of {} packages ({} forward-declared only).\n",
+		PartialSDKPackages.size(), PackageManager::GetPackageInfos().size(), PartialSDKForwardDeclaredPackages.size());
+}
+
+bool CppGenerator::ShouldGeneratePackage(int32 PackageIndex)
+{
+	return PartialSDKPackages.empty() || PartialSDKPackages.contains(PackageIndex);
+}
+
+void CppGenerator::Generate()
+{
+	InitPartialSDK();
+
+	/* Type-strings depend on the unique names of this run */
+	TypeStringCache.clear();
+
+	// Generate SDK.hpp with sorted packages
+	OutputBuffer SdkHpp;
+	GenerateSDKHeader(SdkHpp);
+	SdkHpp.WriteToFile(MainFolder / "SDK.hpp");
+
+	// Generate PropertyFixup.hpp
+	OutputBuffer PropertyFixup;
+	GeneratePropertyFixupFile(PropertyFixup);
+	PropertyFixup.WriteToFile(MainFolder / "PropertyFixup.hpp");
+
+	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
+	OutputBuffer NameCollisionsInl;
+	GenerateNameCollisionsInl(NameCollisionsInl);
+	NameCollisionsInl.WriteToFile(MainFolder / "NameCollisions.inl");
+
+	// Generate UnrealContainers.hpp
+	OutputBuffer UnrealContainers;
+	GenerateUnrealContainers(UnrealContainers);
+	UnrealContainers.WriteToFile(MainFolder / "UnrealContainers.hpp");
+
+	// Generate UtfN.hpp
+	OutputBuffer UnicodeLib;
+	GenerateUnicodeLib(UnicodeLib);
+	UnicodeLib.WriteToFile(MainFolder / "UtfN.hpp");
+
+	OutputBuffer DebugAssertions;
+
+	if constexpr (Settings::Debug::bGenerateAssertionFile)
+	{
+		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets, written after all packages were generated
+		WriteFileHead(DebugAssertions, nullptr, EFileType::DebugAssertions, "Debug assertions to verify member-offsets and struct-sizes");
+
+		//GenerateDebugAssertions(DebugAssertions);
+	}
+
+	// Generate Basic.hpp and Basic.cpp files
+	OutputBuffer BasicHpp;
+	OutputBuffer BasicCpp;
+	GenerateBasicFiles(BasicHpp, BasicCpp, (Settings::Debug::bGenerateAssertionFile ? DebugAssertions : BasicHpp));
+	BasicHpp.WriteToFile(Subfolder / "Basic.hpp");
+	BasicCpp.WriteToFile(Subfolder / "Basic.cpp");
+
+
+	// File lists for VS project generation
+	std::vector<std::string> AllHppFiles;
+	std::vector<std::string> AllCppFiles;
+
+	AllHppFiles.push_back("Basic.hpp");
+	AllCppFiles.push_back("Basic.cpp");
+
+	/* Packages are written to separate files and don't share any state, generate them in parallel */
+	std::vector<PackageInfoHandle> PackagesToGenerate;
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (!Package.IsEmpty() && ShouldGeneratePackage(Package.GetIndex()))
+			PackagesToGenerate.push_back(Package);
+	}
+
+	/* Assertions of all packages go into a single file, buffer them per package and append them in package-order afterwards */
+	std::vector<OutputBuffer> PackageAssertions;
+
+	if constexpr (Settings::Debug::bGenerateAssertionFile)
+		PackageAssertions.resize(PackagesToGenerate.size());
+
+	std::vector<int32> PackageOrder(PackagesToGenerate.size());
+	std::iota(PackageOrder.begin(), PackageOrder.end(), 0x0);
+
+	std::vector<std::vector<SourceFileInfo>> PackageFunctionFiles(PackagesToGenerate.size());
+
+	std::for_each(std::execution::par, PackageOrder.begin(), PackageOrder.end(), [&](int32 Index) -> void
+	{
+		OutputBuffer UnusedAssertions(0x0);
+
+		GeneratePackage(PackagesToGenerate[Index], Settings::Debug::bGenerateAssertionFile ? PackageAssertions[Index] : UnusedAssertions, PackageFunctionFiles[Index]);
+	});
+
+	std::vector<SourceFileInfo> AllFunctionFiles;
+
+	/* Collect file-names and assertions in the same order as sequential generation would, so the output doesn't depend on scheduling */
+	for (int32 i = 0; i < PackagesToGenerate.size(); i++)
+	{
+		PackageInfoHandle Package = PackagesToGenerate[i];
+
+		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
 
-		/* Closes any namespaces if required */
 		if (Package.HasClasses())
-			WriteFileEnd(ClassesFile, EFileType::Classes);
+			AllHppFiles.push_back(FileName + "_classes.hpp");
 
 		if (Package.HasStructs() || Package.HasEnums())
-			WriteFileEnd(StructsFile, EFileType::Structs);
+			AllHppFiles.push_back(FileName + "_structs.hpp");
 
 		if (Package.HasParameterStructs())
-			WriteFileEnd(ParametersFile, EFileType::Parameters);
+			AllHppFiles.push_back(FileName + "_parameters.hpp");
+
+		if constexpr (Settings::CppGenerator::bGenerateForwardDeclarationHeaders)
+		{
+			if (Package.HasEnums())
+				AllHppFiles.push_back(FileName + "_fwd.hpp");
+		}
 
-		if (Package.HasFunctions())
-			WriteFileEnd(FunctionsFile, EFileType::Functions);
+		for (SourceFileInfo& FunctionFile : PackageFunctionFiles[i])
+		{
+			if constexpr (!Settings::CppGenerator::bGenerateUnityBuild)
+				AllCppFiles.push_back(FunctionFile.FileName);
+
+			AllFunctionFiles.push_back(std::move(FunctionFile));
+		}
+
+		if constexpr (Settings::Debug::bGenerateAssertionFile)
+			DebugAssertions << PackageAssertions[i].View();
+	}
+
+	/* Packages outside of the partial SDK, of which only enums are used */
+	for (const int32 PackageIndex : PartialSDKForwardDeclaredPackages)
+	{
+		PackageInfoHandle Package = PackageManager::GetInfo(PackageIndex);
+
+		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName() + "_fwd.hpp";
+
+		OutputBuffer FwdFile(0x1000);
+		GenerateForwardDeclarationFile(FwdFile, Package);
+
+		if (!FwdFile.WriteToFile(Subfolder / reinterpret_cast<const std::u8string&>(FileName)))
+			std::cerr << std::format("Error opening file \"{}\"\n", FileName);
+
+		AllHppFiles.push_back(FileName);
+	}
+
+	if constexpr (Settings::CppGenerator::bGenerateNameTables)
+	{
+		OutputBuffer ClassNameTable;
+		GenerateClassNameTable(ClassNameTable, PackagesToGenerate);
+
+		if (!ClassNameTable.WriteToFile(Subfolder / "ClassNameTable.hpp"))
+			std::cerr << "Error opening file \"ClassNameTable.hpp\"\n";
+
+		AllHppFiles.push_back("ClassNameTable.hpp");
 	}
 
+	if constexpr (Settings::CppGenerator::bGenerateUnityBuild)
+		GenerateUnityBuildFiles(AllFunctionFiles, AllCppFiles);
+
 	// ============================================================
 	// Blueprint Bytecode Decompilation Pass
 	// ============================================================
@@ -2605,14 +3550,13 @@ void CppGenerator::Generate()
 
 			for (PackageInfoHandle BPPackage : PackageManager::IterateOverPackageInfos())
 			{
-				if (BPPackage.IsEmpty() || !BPPackage.HasFunctions())
+				if (BPPackage.IsEmpty() || !BPPackage.HasFunctions() || !ShouldGeneratePackage(BPPackage.GetIndex()))
 					continue;
 
 				const std::string BPFileName = Settings::CppGenerator::FilePrefix + BPPackage.GetName();
 				const std::u8string U8BPFileName = reinterpret_cast<const std::u8string&>(BPFileName);
 
-				StreamType BPFile;
-				bool bFileOpened = false;
+				OutputBuffer BPFile;
 
 				auto DecompileStructFunctions = [&](int32 Index)
 				{
@@ -2627,18 +3571,11 @@ void CppGenerator::Generate()
 						if (!Func.HasScript())
 							continue;
 
-						// Lazy-open file on first blueprint function
-						if (!bFileOpened)
+						// Write the file-head on the first blueprint function, packages without any don't get a file
+						if (BPFile.IsEmpty())
 						{
-							BPFile = StreamType(BlueprintFolder / (U8BPFileName + u8"_blueprint.txt"));
-							if (!BPFile.is_open())
-							{
-								std::cerr << "Error opening blueprint file for " << BPFileName << std::endl;
-								return;
-							}
 							BPFile << "// Blueprint Bytecode Decompilation\n";
 							BPFile << "// Package: " << BPPackage.GetName() << "\n\n";
-							bFileOpened = true;
 						}
 
 						auto Result = BlueprintDecompiler::Decompile(Func);
@@ -2657,6 +3594,9 @@ void CppGenerator::Generate()
 
 				if (BPPackage.HasStructs())
 					BPPackage.GetSortedStructs().VisitAllNodesWithCallback(DecompileStructFunctions);
+
+				if (!BPFile.IsEmpty() && !BPFile.WriteToFile(BlueprintFolder / (U8BPFileName + u8"_blueprint.txt")))
+					std::cerr << "Error opening blueprint file for " << BPFileName << std::endl;
 			}
 
 			std::cerr << std::format("Blueprint decompilation complete: {} functions decompiled.\n", TotalDecompiled);
@@ -2670,6 +3610,7 @@ void CppGenerator::Generate()
 	if constexpr (Settings::Debug::bGenerateAssertionFile)
 	{
 		WriteFileEnd(DebugAssertions, EFileType::DebugAssertions);
+		DebugAssertions.WriteToFile(MainFolder / "Assertions.inl");
 	}
 
 	// Generate VTHook.hpp
@@ -3293,13 +4234,22 @@ void CppGenerator::InitPredefinedFunctions()
 
 	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
 
+	/* The index re-indexes reused slots before it returns nullptr, a linear search afterwards wouldn't find anything */
+	constexpr const char* FindObjectIndexedBody = R"({
+	return BasicFilesImpleUtils::FindObjectByNameIndexed(FullName, static_cast<uint64>(RequiredType), true);
+})";
+
+	constexpr const char* FindObjectFastIndexedBody = R"({
+	return BasicFilesImpleUtils::FindObjectByNameIndexed(Name, static_cast<uint64>(RequiredType), false);
+})";
+
 	UObjectPredefs.Functions =
 	{
 		/* static non-inline functions */
 		PredefinedFunction {
 			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
 			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
+			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bGenerateObjectNameIndex ? FindObjectIndexedBody :
 R"({
 	for (int i = 0; i < GObjects->Num(); ++i)
 	{
@@ -3319,7 +4269,7 @@ R"({
 		PredefinedFunction {
 			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
 			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body =
+			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bGenerateObjectNameIndex ? FindObjectFastIndexedBody :
 R"({
 	for (int i = 0; i < GObjects->Num(); ++i)
 	{
@@ -4368,7 +5318,7 @@ R"({
 }
 
 
-void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp, StreamType& AssertionsFile)
+void CppGenerator::GenerateBasicFiles(OutputBuffer& BasicHpp, OutputBuffer& BasicCpp, OutputBuffer& AssertionsFile)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
@@ -4385,147 +5335,625 @@ void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp
 #include <type_traits>
 )";
 
-	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
-	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>");
+	if constexpr (CppSettings::bGenerateNameTables)
+		CustomIncludes += "#include <string_view>\n";
+
+	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
+	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>\n#include <unordered_map>\n#include <vector>\n#include <mutex>\n#include <algorithm>");
+
+
+	/* use namespace of UnrealContainers */
+	BasicHpp <<
+		R"(
+using namespace UC;
+)";
+
+	BasicHpp << "\n#include \"../NameCollisions.inl\"\n";
+
+	std::string GetNameEntryFromNameOffsetText;
+
+	if (Off::InSDK::Name::bIsAppendStringInlinedAndUsed)
+		GetNameEntryFromNameOffsetText = std::format("\n	constexpr int32 GetNameEntry      = 0x{:08X};", Off::InSDK::Name::GetNameEntryFromName);
+
+	/* Offsets and disclaimer */
+	BasicHpp.Format(R"(
+/*
+* Disclaimer:
+*	- The 'GNames' is only a fallback and null by default, FName::AppendString is used
+*	- THe 'GWorld' offset is not used by the SDK, it's just there for "decoration", use the provided 'UWorld::GetWorld()' function instead
+*/
+namespace Offsets
+{{
+	constexpr int32 GObjects          = 0x{:08X};
+	constexpr int32 AppendString      = 0x{:08X};{}
+	constexpr int32 GNames            = 0x{:08X};
+	constexpr int32 GWorld            = 0x{:08X};
+	constexpr int32 ProcessEvent      = 0x{:08X};
+	constexpr int32 ProcessEventIdx   = 0x{:08X};
+	constexpr int32 GVCPostRenderIdx  = 0x{:08X};
+	constexpr int32 HUDPostRenderIdx  = 0x{:08X};
+}}
+)", max(Off::InSDK::ObjArray::GObjects, 0x0),
+	max(Off::InSDK::Name::AppendNameToString, 0x0),
+	GetNameEntryFromNameOffsetText,
+	max(Off::InSDK::NameArray::GNames, 0x0),
+	max(Off::InSDK::World::GWorld, 0x0),
+	max(Off::InSDK::ProcessEvent::PEOffset, 0x0),
+	Off::InSDK::ProcessEvent::PEIndex,
+	Off::InSDK::PostRender::GVCPostRenderIndex,
+	Off::InSDK::PostRender::HUDPostRenderIndex);
+
+
+	// Start Namespace 'InSDKUtils'
+	BasicHpp <<
+		R"(
+namespace InSDKUtils
+{
+)";
+
+
+	/* Custom 'GetImageBase' function */
+	BasicHpp << "\tuintptr_t GetImageBase();\n\n";
+
+
+	/* GetVirtualFunction(const void* ObjectInstance, int32 Index) function */
+	BasicHpp << R"(	template<typename FuncType>
+	inline FuncType GetVirtualFunction(const void* ObjectInstance, int32 Index)
+	{
+		void** VTable = *reinterpret_cast<void***>(const_cast<void*>(ObjectInstance));
+
+		return reinterpret_cast<FuncType>(VTable[Index]);
+	}
+)";
+
+	//Customizable part of Cpp code to allow for a custom 'CallGameFunction' function
+	BasicHpp << CppSettings::CallGameFunction;
+
+	BasicHpp << "}\n\n";
+	// End Namespace 'InSDKUtils'
+
+	/* Custom 'GetImageBase' function */
+	BasicCpp.Format(R"(uintptr_t InSDKUtils::GetImageBase()
+{})", Settings::CppGenerator::GetImageBaseFuncBody);
+
+	BasicHpp << R"(
+// Forward declarations because in-line forward declarations make the compiler think 'GetStaticClass()' is a class template
+class UClass;
+class UObject;
+class UFunction;
+
+class FName;
+)";
+
+	BasicHpp << R"(
+namespace BasicFilesImpleUtils
+{
+	// Helper functions for GetStaticClass and GetStaticBPGeneratedClass
+	UClass* FindClassByName(const std::string& Name, bool bByFullName = false);
+	UClass* FindClassByFullName(const std::string& Name);
+
+	/* Returns the class at the object-index from SDK-generation, if that slot still holds a class with the same FName. Otherwise nullptr. */
+	UClass* GetClassByIndexHint(int32 ObjectIndexHint, int32 NameIndexHint, uint32 NameNumberHint, const char* FullNameToCompare = nullptr);
+
+	/* Looks up the class through the FName-keyed index of GObjects if 'bGenerateObjectNameIndex' is enabled, otherwise the same as FindClassFast. */
+	UClass* FindClassByNameIndexed(const std::string& Name);
+
+	std::string GetObjectName(class UClass* Class);
+	int32 GetObjectIndex(class UClass* Class);
+
+	/* FName represented as a uint64. */
+	uint64 GetObjFNameAsUInt64(class UClass* Class);
+
+	UObject* GetObjectByIndex(int32 Index);
+
+	UFunction* FindFunctionByFName(const FName* Name);
+
+	FName StringToName(const wchar_t* Name);
+	FName GetObjFName(class UClass* Class);
+)";
+
+	if constexpr (CppSettings::bGenerateObjectNameIndex)
+	{
+		BasicHpp << R"(
+	/*
+	* Lookups through an FName-keyed index of GObjects, built on first use. 'RequiredTypeFlags' is an EClassCastFlags value.
+	* Full names are resolved part by part through the outers, comparing FNames. Before a lookup returns nullptr all slots are
+	* re-indexed, at most once per value of GObjects->Num(), so objects in reused slots are found as well.
+	*/
+	UObject* FindObjectByNameIndexed(const std::string& Name, uint64 RequiredTypeFlags, bool bIsFullName);
+	UObject* FindObjectByFNameIndexed(const FName& Name);
+)";
+	}
+
+	if constexpr (CppSettings::bGenerateFunctionTables)
+	{
+		BasicHpp << R"(
+	struct FFunctionTableEntry
+	{
+		const char* Name;
+		int32 Index;
+	};
+
+	/* Fills 'OutTable' with the functions of 'Class' in a single pass over its 'Children'. 'Entries' must be sorted by name. */
+	void ResolveFunctionTable(const UClass* Class, const FFunctionTableEntry* Entries, int32 NumEntries, UFunction** OutTable);
+)";
+	}
+
+	if constexpr (CppSettings::bGenerateNativeFastPath)
+	{
+		BasicHpp << R"(
+	/*
+	* Calls the 'ExecFunction' of a native function without input-parameters directly, the return-value is written to 'ReturnValue'.
+	* Falls back to ProcessEvent with 'Parms' if the function has no 'ExecFunction'.
+	*/
+	void CallNativeFunction(const UObject* Object, UFunction* Function, void* Parms, void* ReturnValue);
+)";
+	}
+
+	if constexpr (CppSettings::bGenerateNameTables)
+	{
+		BasicHpp << R"(
+	/* Seeded FNV-1a, the name-tables are built at SDK-generation time with the same function */
+	constexpr uint32 HashTableName(std::string_view Name, uint32 Seed)
+	{
+		uint32 Hash = 0x811C9DC5 ^ Seed;
+
+		for (const char Char : Name)
+			Hash = (Hash ^ static_cast<uint8>(Char)) * 0x01000193;
+
+		return Hash;
+	}
+
+	/*
+	* Minimal perfect-hash table of names, built at SDK-generation time. The name is hashed to a bucket, of which the seed selects the only slot the name
+	* can be in. Seeds with the highest bit set are the slot itself. Every lookup costs two hashes and one string-comparison.
+	*/
+	template<typename ValueType, int32 NumSlots, int32 NumBuckets>
+	struct TPerfectHashTable
+	{
+		struct FEntry
+		{
+			const char* Name;
+			ValueType Value;
+		};
+
+		FEntry Entries[NumSlots];
+		uint32 Seeds[NumBuckets];
+
+		constexpr const FEntry* Find(std::string_view Name) const
+		{
+			const uint32 Seed = Seeds[HashTableName(Name, 0x0) % NumBuckets];
+			const uint32 Slot = (Seed & 0x80000000) ? (Seed & 0x7FFFFFFF) : (HashTableName(Name, Seed) % NumSlots);
+
+			return Name == Entries[Slot].Name ? &Entries[Slot] : nullptr;
+		}
+	};
+)";
+	}
+
+	BasicHpp << R"(}
+)";
+
+	BasicCpp << R"(
+class UClass* BasicFilesImpleUtils::FindClassByName(const std::string& Name, bool bByFullName)
+{
+	return bByFullName ? UObject::FindClass(Name) : UObject::FindClassFast(Name);
+}
+
+class UClass* BasicFilesImpleUtils::FindClassByFullName(const std::string& Name)
+{
+	return UObject::FindClass(Name);
+}
+)";
+
+	BasicCpp.Format(R"(
+class UClass* BasicFilesImpleUtils::GetClassByIndexHint(int32 ObjectIndexHint, int32 NameIndexHint, uint32 NameNumberHint, const char* FullNameToCompare)
+{{
+	if (ObjectIndexHint < 0 || ObjectIndexHint >= UObject::GObjects->Num())
+		return nullptr;
+
+	UObject* Object = UObject::GObjects->GetByIndex(ObjectIndexHint);
+
+	if (!Object || Object->Name.ComparisonIndex != NameIndexHint{} || !Object->HasTypeFlag(EClassCastFlags::Class))
+		return nullptr;
+
+	/* Classes with non-unique names are identified by their full name */
+	if (FullNameToCompare && Object->GetFullName() != FullNameToCompare)
+		return nullptr;
+
+	return static_cast<UClass*>(Object);
+}}
+)", !Settings::Internal::bUseOutlineNumberName ? " || Object->Name.Number != NameNumberHint" : "");
+
+	BasicCpp << R"(
+std::string BasicFilesImpleUtils::GetObjectName(class UClass* Class)
+{
+	return Class->GetName();
+}
+
+int32 BasicFilesImpleUtils::GetObjectIndex(class UClass* Class)
+{
+	return Class->Index;
+}
+
+uint64 BasicFilesImpleUtils::GetObjFNameAsUInt64(class UClass* Class)
+{
+	return *reinterpret_cast<uint64*>(&Class->Name);
+}
+
+class UObject* BasicFilesImpleUtils::GetObjectByIndex(int32 Index)
+{
+	return UObject::GObjects->GetByIndex(Index);
+}
+)";
+
+	if constexpr (CppSettings::bGenerateObjectNameIndex)
+	{
+		BasicCpp.Format(R"(
+namespace
+{{
+	/*
+	* Indices into GObjects by FName. New objects are indexed incrementally when GObjects->Num() grew since the last lookup,
+	* if it shrank the index is rebuilt. Slots can be reused by other objects, so every candidate is validated before it's returned.
+	* A lookup without a match re-indexes all slots, at most once per value of GObjects->Num(). Indices of a name are sorted, the first match wins.
+	*/
+	class FObjectNameIndex
+	{{
+	private:
+		std::mutex IndexLock;
+
+		int32 NumIndexedObjects = 0;
+		int32 NumObjectsAtLastReindex = -1;
+
+		std::unordered_map<uint64, std::vector<int32>> ObjectsByName;
+
+		/* Every distinct name is converted to a string once, when the first object with this name is indexed */
+		std::unordered_map<std::string, uint64> NameKeysByString;
+
+	public:
+		static uint64 GetNameKey(const FName& Name)
+		{{
+			return {};
+		}}
+
+	private:
+		void Update()
+		{{
+			const int32 NumObjects = UObject::GObjects->Num();
+
+			if (NumObjects == NumIndexedObjects)
+				return;
+
+			if (NumObjects < NumIndexedObjects)
+			{{
+				ObjectsByName.clear();
+				NameKeysByString.clear();
+				NumIndexedObjects = 0;
+			}}
+
+			for (int i = NumIndexedObjects; i < NumObjects; ++i)
+			{{
+				UObject* Object = UObject::GObjects->GetByIndex(i);
+
+				if (!Object)
+					continue;
+
+				const uint64 NameKey = GetNameKey(Object->Name);
+
+				auto [It, bIsNewName] = ObjectsByName.try_emplace(NameKey);
+
+				if (bIsNewName)
+					NameKeysByString.try_emplace(Object->GetName(), NameKey);
+
+				It->second.push_back(i);
+			}}
+
+			NumIndexedObjects = NumObjects;
+		}}
+
+		/* Slots below 'NumIndexedObjects' can hold other objects than when they were indexed. Names are kept, FNames are never removed. */
+		void Reindex()
+		{{
+			for (auto& [NameKey, Indices] : ObjectsByName)
+				Indices.clear();
+
+			NumIndexedObjects = 0;
+
+			Update();
+		}}
+
+		/*
+		* Repeated lookups of missing objects don't walk GObjects again, unless GObjects->Num() changed in the meantime.
+		* An object taking over a slot without changing the count is only found after the next change.
+		*/
+		bool TryReindex()
+		{{
+			if (NumIndexedObjects == NumObjectsAtLastReindex)
+				return false;
+
+			Reindex();
+
+			NumObjectsAtLastReindex = NumIndexedObjects;
+			return true;
+		}}
+
+		template<typename PredicateType>
+		UObject* FindIndexed(uint64 NameKey, PredicateType&& Predicate)
+		{{
+			auto It = ObjectsByName.find(NameKey);
+
+			if (It == ObjectsByName.end())
+				return nullptr;
+
+			for (const int32 Index : It->second)
+			{{
+				UObject* Object = UObject::GObjects->GetByIndex(Index);
+
+				if (!Object || GetNameKey(Object->Name) != NameKey)
+					continue;
+
+				if (Predicate(Object))
+					return Object;
+			}}
+
+			return nullptr;
+		}}
+
+		bool FindKey(const std::string& Name, uint64* OutNameKey)
+		{{
+			auto It = NameKeysByString.find(Name);
+
+			if (It == NameKeysByString.end())
+				return false;
+
+			*OutNameKey = It->second;
+			return true;
+		}}
+
+		/* 'FullName' is 'Class Package.Outer.Name'. Every part is resolved to its FName, each object is found by its name and the previous part as its outer. */
+		template<typename PredicateType>
+		UObject* FindFullNameIndexed(const std::string& FullName, PredicateType& Predicate)
+		{{
+			const size_t ClassNameEnd = FullName.find(' ');
+
+			uint64 ClassNameKey = 0x0;
+
+			if (ClassNameEnd == std::string::npos || !FindKey(FullName.substr(0, ClassNameEnd), &ClassNameKey))
+				return nullptr;
+
+			UObject* Outer = nullptr;
+
+			for (size_t PartStart = ClassNameEnd + 1; PartStart <= FullName.size();)
+			{{
+				const size_t PartEnd = FullName.find('.', PartStart);
+				const bool bIsLastPart = PartEnd == std::string::npos;
+
+				uint64 NameKey = 0x0;
+
+				if (!FindKey(FullName.substr(PartStart, bIsLastPart ? std::string::npos : PartEnd - PartStart), &NameKey))
+					return nullptr;
+
+				UObject* Object = FindIndexed(NameKey, [&](UObject* Candidate) -> bool
+				{{
+					if (Candidate->Outer != Outer)
+						return false;
+
+					return !bIsLastPart || (Candidate->Class && GetNameKey(Candidate->Class->Name) == ClassNameKey && Predicate(Candidate));
+				}});
+
+				if (!Object || bIsLastPart)
+					return Object;
+
+				Outer = Object;
+				PartStart = PartEnd + 1;
+			}}
+
+			return nullptr;
+		}}
+
+	public:
+		template<typename PredicateType>
+		UObject* FindByKey(uint64 NameKey, PredicateType&& Predicate)
+		{{
+			std::scoped_lock Lock(IndexLock);
+
+			Update();
+
+			if (UObject* Object = FindIndexed(NameKey, Predicate))
+				return Object;
 
+			if (!TryReindex())
+				return nullptr;
 
-	/* use namespace of UnrealContainers */
-	BasicHpp <<
-		R"(
-using namespace UC;
-)";
+			return FindIndexed(NameKey, Predicate);
+		}}
 
-	BasicHpp << "\n#include \"../NameCollisions.inl\"\n";
+		template<typename PredicateType>
+		UObject* FindByString(const std::string& Name, PredicateType&& Predicate)
+		{{
+			std::scoped_lock Lock(IndexLock);
 
-	std::string GetNameEntryFromNameOffsetText;
+			Update();
 
-	if (Off::InSDK::Name::bIsAppendStringInlinedAndUsed)
-		GetNameEntryFromNameOffsetText = std::format("\n	constexpr int32 GetNameEntry      = 0x{:08X};", Off::InSDK::Name::GetNameEntryFromName);
+			uint64 NameKey = 0x0;
 
-	/* Offsets and disclaimer */
-	BasicHpp << std::format(R"(
-/*
-* Disclaimer:
-*	- The 'GNames' is only a fallback and null by default, FName::AppendString is used
-*	- THe 'GWorld' offset is not used by the SDK, it's just there for "decoration", use the provided 'UWorld::GetWorld()' function instead
-*/
-namespace Offsets
-{{
-	constexpr int32 GObjects          = 0x{:08X};
-	constexpr int32 AppendString      = 0x{:08X};{}
-	constexpr int32 GNames            = 0x{:08X};
-	constexpr int32 GWorld            = 0x{:08X};
-	constexpr int32 ProcessEvent      = 0x{:08X};
-	constexpr int32 ProcessEventIdx   = 0x{:08X};
-	constexpr int32 GVCPostRenderIdx  = 0x{:08X};
-	constexpr int32 HUDPostRenderIdx  = 0x{:08X};
-}}
-)", max(Off::InSDK::ObjArray::GObjects, 0x0),
-	max(Off::InSDK::Name::AppendNameToString, 0x0),
-	GetNameEntryFromNameOffsetText,
-	max(Off::InSDK::NameArray::GNames, 0x0),
-	max(Off::InSDK::World::GWorld, 0x0),
-	max(Off::InSDK::ProcessEvent::PEOffset, 0x0),
-	Off::InSDK::ProcessEvent::PEIndex,
-	Off::InSDK::PostRender::GVCPostRenderIndex,
-	Off::InSDK::PostRender::HUDPostRenderIndex);
+			if (FindKey(Name, &NameKey))
+			{{
+				if (UObject* Object = FindIndexed(NameKey, Predicate))
+					return Object;
+			}}
 
+			if (!TryReindex())
+				return nullptr;
 
-	// Start Namespace 'InSDKUtils'
-	BasicHpp <<
-		R"(
-namespace InSDKUtils
-{
-)";
+			return FindKey(Name, &NameKey) ? FindIndexed(NameKey, Predicate) : nullptr;
+		}}
 
+		template<typename PredicateType>
+		UObject* FindByFullName(const std::string& FullName, PredicateType&& Predicate)
+		{{
+			std::scoped_lock Lock(IndexLock);
 
-	/* Custom 'GetImageBase' function */
-	BasicHpp << "\tuintptr_t GetImageBase();\n\n";
+			Update();
 
+			if (UObject* Object = FindFullNameIndexed(FullName, Predicate))
+				return Object;
 
-	/* GetVirtualFunction(const void* ObjectInstance, int32 Index) function */
-	BasicHpp << R"(	template<typename FuncType>
-	inline FuncType GetVirtualFunction(const void* ObjectInstance, int32 Index)
-	{
-		void** VTable = *reinterpret_cast<void***>(const_cast<void*>(ObjectInstance));
+			if (!TryReindex())
+				return nullptr;
 
-		return reinterpret_cast<FuncType>(VTable[Index]);
-	}
-)";
+			return FindFullNameIndexed(FullName, Predicate);
+		}}
+	}};
 
-	//Customizable part of Cpp code to allow for a custom 'CallGameFunction' function
-	BasicHpp << CppSettings::CallGameFunction;
+	FObjectNameIndex& GetObjectNameIndex()
+	{{
+		static FObjectNameIndex Index;
+		return Index;
+	}}
+}}
 
-	BasicHpp << "}\n\n";
-	// End Namespace 'InSDKUtils'
+class UObject* BasicFilesImpleUtils::FindObjectByNameIndexed(const std::string& Name, uint64 RequiredTypeFlags, bool bIsFullName)
+{{
+	auto HasRequiredType = [RequiredTypeFlags](UObject* Object) -> bool
+	{{
+		return Object->HasTypeFlag(static_cast<EClassCastFlags>(RequiredTypeFlags));
+	}};
 
-	/* Custom 'GetImageBase' function */
-	BasicCpp << std::format(R"(uintptr_t InSDKUtils::GetImageBase()
-{})", Settings::CppGenerator::GetImageBaseFuncBody);
+	if (bIsFullName)
+		return GetObjectNameIndex().FindByFullName(Name, HasRequiredType);
 
-	BasicHpp << R"(
-// Forward declarations because in-line forward declarations make the compiler think 'GetStaticClass()' is a class template
-class UClass;
-class UObject;
-class UFunction;
+	return GetObjectNameIndex().FindByString(Name, HasRequiredType);
+}}
 
-class FName;
+class UObject* BasicFilesImpleUtils::FindObjectByFNameIndexed(const FName& Name)
+{{
+	return GetObjectNameIndex().FindByKey(FObjectNameIndex::GetNameKey(Name), [](UObject* Object) -> bool {{ return true; }});
+}}
+
+class UClass* BasicFilesImpleUtils::FindClassByNameIndexed(const std::string& Name)
+{{
+	return static_cast<UClass*>(FindObjectByNameIndexed(Name, static_cast<uint64>(EClassCastFlags::Class), false));
+}}
+)", !Settings::Internal::bUseOutlineNumberName
+		? "(static_cast<uint64>(Name.Number) << 32) | static_cast<uint32>(Name.ComparisonIndex)"
+		: "static_cast<uint32>(Name.ComparisonIndex)");
+	}
+	else
+	{
+		BasicCpp << R"(
+class UClass* BasicFilesImpleUtils::FindClassByNameIndexed(const std::string& Name)
+{
+	return UObject::FindClassFast(Name);
+}
 )";
+	}
 
-	BasicHpp << R"(
-namespace BasicFilesImpleUtils
+	if constexpr (CppSettings::bGenerateFunctionTables)
+	{
+		BasicCpp << R"(
+void BasicFilesImpleUtils::ResolveFunctionTable(const UClass* Class, const FFunctionTableEntry* Entries, int32 NumEntries, UFunction** OutTable)
 {
-	// Helper functions for GetStaticClass and GetStaticBPGeneratedClass
-	UClass* FindClassByName(const std::string& Name, bool bByFullName = false);
-	UClass* FindClassByFullName(const std::string& Name);
+	if (!Class)
+		return;
 
-	std::string GetObjectName(class UClass* Class);
-	int32 GetObjectIndex(class UClass* Class);
+	const FFunctionTableEntry* const EntriesEnd = Entries + NumEntries;
 
-	/* FName represented as a uint64. */
-	uint64 GetObjFNameAsUInt64(class UClass* Class);
+	for (UField* Field = Class->Children; Field; Field = Field->Next)
+	{
+		if (!Field->HasTypeFlag(EClassCastFlags::Function))
+			continue;
 
-	UObject* GetObjectByIndex(int32 Index);
+		const std::string FieldName = Field->GetName();
 
-	UFunction* FindFunctionByFName(const FName* Name);
+		auto It = std::lower_bound(Entries, EntriesEnd, FieldName, [](const FFunctionTableEntry& Entry, const std::string& Name) -> bool
+		{
+			return Name.compare(Entry.Name) > 0;
+		});
 
-	FName StringToName(const wchar_t* Name);
+		if (It != EntriesEnd && FieldName == It->Name)
+			OutTable[It->Index] = static_cast<UFunction*>(Field);
+	}
 }
 )";
+	}
 
-	BasicCpp << R"(
-class UClass* BasicFilesImpleUtils::FindClassByName(const std::string& Name, bool bByFullName)
+	if constexpr (CppSettings::bGenerateNativeFastPath)
+	{
+		BasicCpp << R"(
+namespace
 {
-	return bByFullName ? UObject::FindClass(Name) : UObject::FindClassFast(Name);
-}
+	void* NoOpVirtualFunction()
+	{
+		return nullptr;
+	}
 
-class UClass* BasicFilesImpleUtils::FindClassByFullName(const std::string& Name)
-{
-	return UObject::FindClass(Name);
-}
+	/* More entries than FOutputDevice has virtual functions on any engine-version */
+	struct FNoOpVTable
+	{
+		void* (*Functions[0x40])();
 
-std::string BasicFilesImpleUtils::GetObjectName(class UClass* Class)
-{
-	return Class->GetName();
-}
+		FNoOpVTable()
+		{
+			for (auto& Function : Functions)
+				Function = &NoOpVirtualFunction;
+		}
+	};
 
-int32 BasicFilesImpleUtils::GetObjectIndex(class UClass* Class)
-{
-	return Class->Index;
-}
+	const FNoOpVTable NoOpOutputDeviceVTable;
 
-uint64 BasicFilesImpleUtils::GetObjFNameAsUInt64(class UClass* Class)
-{
-	return *reinterpret_cast<uint64*>(&Class->Name);
+	/* Offsets of FFrame's members after FOutputDevice, unchanged since UE4.0 */
+	constexpr int32 FFrameNodeOffset = 0x10;
+	constexpr int32 FFrameObjectOffset = 0x18;
+	constexpr int32 FFrameLocalsOffset = 0x28;
 }
 
-class UObject* BasicFilesImpleUtils::GetObjectByIndex(int32 Index)
+void BasicFilesImpleUtils::CallNativeFunction(const UObject* Object, UFunction* Function, void* Parms, void* ReturnValue)
 {
-	return UObject::GObjects->GetByIndex(Index);
+	if (!Function->ExecFunction)
+	{
+		auto Flgs = Function->FunctionFlags;
+		Function->FunctionFlags |= 0x400;
+
+		Object->ProcessEvent(Function, Parms);
+
+		Function->FunctionFlags = Flgs;
+		return;
+	}
+
+	/*
+	* The thunk of a function without input-parameters doesn't read any parameters from the FFrame, 'P_FINISH' only steps over 'Code', which
+	* is nullptr here. The buffer is larger than FFrame on all engine-versions. The SDK-generator only emits calls to this function for
+	* natives of which all parameters are the return-value.
+	*
+	* 'Node', 'Object' and 'Locals' are filled like ProcessEvent does, for custom thunks reading them. All other members stay zeroed.
+	* FFrame inherits the vtable of FOutputDevice, it's set to virtual functions doing nothing, in case the thunk logs through the frame.
+	*/
+	alignas(0x10) uint8 Frame[0x100] = {};
+	*reinterpret_cast<const void**>(Frame) = &NoOpOutputDeviceVTable;
+	*reinterpret_cast<UFunction**>(Frame + FFrameNodeOffset) = Function;
+	*reinterpret_cast<const UObject**>(Frame + FFrameObjectOffset) = Object;
+	*reinterpret_cast<void**>(Frame + FFrameLocalsOffset) = Parms;
+
+	Function->ExecFunction(const_cast<UObject*>(Object), Frame, ReturnValue);
 }
+)";
+	}
 
+	BasicCpp << R"(
 UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
-{
+{)";
+
+	if constexpr (CppSettings::bGenerateObjectNameIndex)
+	{
+		BasicCpp << R"(
+	return static_cast<UFunction*>(BasicFilesImpleUtils::FindObjectByFNameIndexed(*Name));
+}
+)";
+	}
+	else
+	{
+		BasicCpp << R"(
 	for (int i = 0; i < UObject::GObjects->Num(); ++i)
 	{
 		UObject* Object = UObject::GObjects->GetByIndex(i);
@@ -4539,15 +5967,24 @@ UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
 
 	return nullptr;
 }
+)";
+	}
 
+	BasicCpp << R"(
 FName BasicFilesImpleUtils::StringToName(const wchar_t* Name)
 {
 	return UKismetStringLibrary::Conv_StringToName(FString(Name));
 }
+
+FName BasicFilesImpleUtils::GetObjFName(class UClass* Class)
+{
+	return Class->Name;
+}
 )";
 
 	BasicHpp << R"(
 const FName& GetStaticName(const wchar_t* Name, FName& StaticName);
+const FName& GetStaticNameWithHint(const wchar_t* Name, FName& StaticName, int32 ObjectIndexHint, int32 NameIndexHint, uint32 NameNumberHint);
 )";
 
 	BasicCpp << R"(
@@ -4560,6 +5997,24 @@ const FName& GetStaticName(const wchar_t* Name, FName& StaticName)
 
 	return StaticName;
 }
+
+const FName& GetStaticNameWithHint(const wchar_t* Name, FName& StaticName, int32 ObjectIndexHint, int32 NameIndexHint, uint32 NameNumberHint)
+{
+	if (StaticName.IsNone())
+	{
+		/* The name of the class is the static name, this avoids calling Conv_StringToName */
+		if (UClass* HintedClass = BasicFilesImpleUtils::GetClassByIndexHint(ObjectIndexHint, NameIndexHint, NameNumberHint))
+		{
+			StaticName = BasicFilesImpleUtils::GetObjFName(HintedClass);
+		}
+		else
+		{
+			StaticName = BasicFilesImpleUtils::StringToName(Name);
+		}
+	}
+
+	return StaticName;
+}
 )";
 
 	/* Implementation of 'UObject::StaticClass()', templated to allow for a per-class local static class-pointer */
@@ -4579,6 +6034,31 @@ class UClass* GetStaticClassImpl(const char* Name, class UClass*& StaticClass)
 
 	return StaticClass;
 }
+)";
+
+	/* Same as 'GetStaticClassImpl', but tries the object-index from SDK-generation first */
+	BasicHpp << R"(
+template<bool bIsFullName = false>
+class UClass* GetStaticClassWithHintImpl(const char* Name, class UClass*& StaticClass, int32 ObjectIndexHint, int32 NameIndexHint, uint32 NameNumberHint)
+{
+	if (StaticClass == nullptr)
+	{
+		if constexpr (bIsFullName) {
+			StaticClass = BasicFilesImpleUtils::GetClassByIndexHint(ObjectIndexHint, NameIndexHint, NameNumberHint, Name);
+
+			if (!StaticClass)
+				StaticClass = BasicFilesImpleUtils::FindClassByFullName(Name);
+		}
+		else /* default */ {
+			StaticClass = BasicFilesImpleUtils::GetClassByIndexHint(ObjectIndexHint, NameIndexHint, NameNumberHint);
+
+			if (!StaticClass)
+				StaticClass = BasicFilesImpleUtils::FindClassByNameIndexed(Name);
+		}
+	}
+
+	return StaticClass;
+}
 )";
 
 	/* Implementation of 'UObject::StaticClass()' for 'BlueprintGeneratedClass', templated to allow for a per-class local static class-index */
@@ -4657,6 +6137,18 @@ ClassType* GetDefaultObjImpl()
     return GetStaticClassImpl<true>(FullNameString, Clss); \
 }
 
+#define STATIC_CLASS_IMPL_HINTED(NameString, ObjectIndexHint, NameIndexHint, NameNumberHint) \
+{ \
+    static UClass* Clss = nullptr; \
+    return GetStaticClassWithHintImpl(NameString, Clss, ObjectIndexHint, NameIndexHint, NameNumberHint); \
+}
+
+#define STATIC_CLASS_IMPL_FULLNAME_HINTED(FullNameString, ObjectIndexHint, NameIndexHint, NameNumberHint) \
+{ \
+    static UClass* Clss = nullptr; \
+    return GetStaticClassWithHintImpl<true>(FullNameString, Clss, ObjectIndexHint, NameIndexHint, NameNumberHint); \
+}
+
 #define BP_STATIC_CLASS_IMPL(NameString) \
 { \
     static int32 ClassIdx = 0;   \
@@ -4676,6 +6168,12 @@ ClassType* GetDefaultObjImpl()
     static FName Name = FName(); \
     return GetStaticName(NameString, Name); \
 }
+
+#define STATIC_NAME_IMPL_HINTED(NameString, ObjectIndexHint, NameIndexHint, NameNumberHint) \
+{ \
+    static FName Name = FName(); \
+    return GetStaticNameWithHint(NameString, Name, ObjectIndexHint, NameIndexHint, NameNumberHint); \
+}
 )";
 
 	// Start class 'FUObjectItem'
@@ -5609,6 +7107,14 @@ std::format(R"({{
 
 	GenerateStruct(&FName, BasicHpp, BasicCpp, BasicHpp, AssertionsFile);
 
+	BasicHpp.Format(R"(
+/* Hash of FName keys in TSet and TMap, see UC::TSet::FindIndexByHash() */
+inline uint32 GetTypeHash(const FName& Name)
+{{
+	return static_cast<uint32>(Name.ComparisonIndex){};
+}}
+)", !Settings::Internal::bUseOutlineNumberName ? " + Name.Number" : "");
+
 
 	BasicHpp <<
 		R"(
@@ -6778,10 +8284,10 @@ using TActorBasedCycleFixup = CyclicDependencyFixupImpl::TCyclicClassFixup<Under
 
 
 /* See https://github.com/Fischsalat/UnrealContainers/blob/master/UnrealContainers/UnrealContainersNoAlloc.h */
-void CppGenerator::GenerateUnrealContainers(StreamType& UEContainersHeader)
+void CppGenerator::GenerateUnrealContainers(OutputBuffer& UEContainersHeader)
 {
 	WriteFileHead(UEContainersHeader, nullptr, EFileType::UnrealContainers, 
-		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include <optional>\n#include \"UtfN.hpp\"");
+		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include <optional>\n#include <concepts>\n#include \"UtfN.hpp\"");
 
 
 	UEContainersHeader << R"(
@@ -6967,7 +8473,7 @@ namespace UC
 		{
 		private:
 			template<typename SetDataType>
-			friend class TSet;
+			friend class UC::TSet;
 
 		private:
 			SetType Value;
@@ -7375,6 +8881,38 @@ namespace UC
 	};)";
 
 	UEContainersHeader << R"(
+	/* The engine's 'GetTypeHash()' for keys of TSet and TMap, see TSet::FindIndexByHash(). 'GetTypeHash(FName)' is declared in Basic.hpp. */
+	template<typename IntegerType> requires(std::integral<IntegerType>)
+	inline uint32 GetTypeHash(IntegerType Value)
+	{
+		if constexpr (sizeof(IntegerType) <= sizeof(uint32))
+		{
+			return static_cast<uint32>(Value);
+		}
+		else
+		{
+			return static_cast<uint32>(Value) + (static_cast<uint32>(static_cast<uint64>(Value) >> 32) * 23);
+		}
+	}
+
+	template<typename EnumType> requires(std::is_enum_v<EnumType>)
+	inline uint32 GetTypeHash(EnumType Value)
+	{
+		return GetTypeHash(static_cast<std::underlying_type_t<EnumType>>(Value));
+	}
+
+	/* 'PointerHash()', the lower 4 bits are ignored */
+	inline uint32 GetTypeHash(const void* Pointer)
+	{
+		return GetTypeHash(reinterpret_cast<uint64>(Pointer) >> 4);
+	}
+
+	template<typename KeyType>
+	concept CHasTypeHash = requires(const KeyType& Key)
+	{
+		{ GetTypeHash(Key) } -> std::convertible_to<uint32>;
+	};
+
 	template<typename SparseArrayElementType>
 	class TSparseArray
 	{
@@ -7422,7 +8960,7 @@ namespace UC
 
 	public:
 		inline       SparseArrayElementType& operator[](int32 Index)       { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
-		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
+		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
 
 		inline bool operator==(const TSparseArray<SparseArrayElementType>& Other) const { return Data == Other.Data; }
 		inline bool operator!=(const TSparseArray<SparseArrayElementType>& Other) const { return Data != Other.Data; }
@@ -7477,6 +9015,54 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/*
+		* Walks the bucket of 'KeyHash' and its 'HashNextId' chain, like the engine does. 'KeyHash' has to be the hash the engine used for the key.
+		* Returns the index of the first element in the chain for which 'IsMatch' returns true, or -1.
+		*/
+		template<typename PredicateType>
+		inline int32 FindIndexByHash(uint32 KeyHash, PredicateType&& IsMatch) const
+		{
+			if (HashSize <= 0 || !Elements.IsValid())
+				return -1;
+
+			const int32* Buckets = Hash.GetAllocation();
+
+			/* Bounded, as a chain read while the engine modifies the set can contain a loop */
+			int32 NumVisited = 0;
+
+			for (int32 Index = Buckets[KeyHash & (HashSize - 1)]; Index != -1 && NumVisited < NumAllocated(); Index = Elements[Index].HashNextId, NumVisited++)
+			{
+				if (!Elements.IsValidIndex(Index))
+					return -1;
+
+				if (IsMatch(Elements[Index].Value))
+					return Index;
+			}
+
+			return -1;
+		}
+
+		inline const SetElementType* FindByHash(const SetElementType& Key, uint32 KeyHash) const
+			requires std::equality_comparable<SetElementType>
+		{
+			const int32 Index = FindIndexByHash(KeyHash, [&Key](const SetElementType& Element) -> bool { return Element == Key; });
+
+			return Index != -1 ? &(*this)[Index] : nullptr;
+		}
+
+		inline const SetElementType* FindByHash(const SetElementType& Key) const
+			requires std::equality_comparable<SetElementType> && CHasTypeHash<SetElementType>
+		{
+			return FindByHash(Key, GetTypeHash(Key));
+		}
+
+		inline bool Contains(const SetElementType& Key) const
+			requires std::equality_comparable<SetElementType> && CHasTypeHash<SetElementType>
+		{
+			return FindByHash(Key) != nullptr;
+		}
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
@@ -7526,6 +9112,34 @@ namespace UC
 			return end(*this);
 		}
 
+		/* Looks the key up in its hash-bucket instead of comparing it to every element. 'KeyHash' has to be the hash the engine used for the key. */
+		inline ValueElementType* FindByHash(const KeyElementType& Key, uint32 KeyHash, bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey))
+		{
+			const int32 Index = Elements.FindIndexByHash(KeyHash, [&](const ElementType& Element) -> bool { return Equals(Element.Key(), Key); });
+
+			return Index != -1 ? &Elements[Index].Value() : nullptr;
+		}
+
+		inline ValueElementType* FindByHash(const KeyElementType& Key, uint32 KeyHash)
+			requires std::equality_comparable<KeyElementType>
+		{
+			const int32 Index = Elements.FindIndexByHash(KeyHash, [&Key](const ElementType& Element) -> bool { return Element.Key() == Key; });
+
+			return Index != -1 ? &Elements[Index].Value() : nullptr;
+		}
+
+		inline ValueElementType* FindByHash(const KeyElementType& Key)
+			requires std::equality_comparable<KeyElementType> && CHasTypeHash<KeyElementType>
+		{
+			return FindByHash(Key, GetTypeHash(Key));
+		}
+
+		inline bool Contains(const KeyElementType& Key) const
+			requires std::equality_comparable<KeyElementType> && CHasTypeHash<KeyElementType>
+		{
+			return Elements.FindIndexByHash(GetTypeHash(Key), [&Key](const ElementType& Element) -> bool { return Element.Key() == Key; }) != -1;
+		}
+
 	public:
 		inline       ElementType& operator[] (int32 Index)       { return Elements[Index]; }
 		inline const ElementType& operator[] (int32 Index) const { return Elements[Index]; }
@@ -7724,7 +9338,7 @@ namespace UC
 }
 
 /* See https://github.com/Fischsalat/UTF-N */
-void CppGenerator::GenerateUnicodeLib(StreamType& UnicodeLib) {
+void CppGenerator::GenerateUnicodeLib(OutputBuffer& UnicodeLib) {
 	WriteFileHead(UnicodeLib, nullptr, EFileType::UnicodeLib,
 		"A simple C++ lib for converting between Utf8, Utf16 and Utf32. See https://github.com/Fischsalat/UTF-N");
 
@@ -4,6 +4,7 @@
 
 #include "Platform.h"
 #include "OffsetFinder/Offsets.h"
+#include "OutputBuffer.h"
 
 #include <fstream>
 
@@ -900,9 +901,9 @@ static std::string EscapeJsonString(const std::string& Input)
 	return Out;
 }
 
-static void WritePropertyValueAsJson(std::ofstream& Out, UEProperty Prop, const uint8* RowData, int Depth = 0);
+static void WritePropertyValueAsJson(OutputBuffer& Out, UEProperty Prop, const uint8* RowData, int Depth = 0);
 
-static void WriteStructPropertiesAsJson(std::ofstream& Out, UEStruct Struct, const uint8* Data, int Depth)
+static void WriteStructPropertiesAsJson(OutputBuffer& Out, UEStruct Struct, const uint8* Data, int Depth)
 {
 	auto Props = Struct.GetProperties();
 	Out << "{";
@@ -920,7 +921,7 @@ static void WriteStructPropertiesAsJson(std::ofstream& Out, UEStruct Struct, con
 	Out << "}";
 }
 
-static void WritePropertyValueAsJson(std::ofstream& Out, UEProperty Prop, const uint8* RowData, int Depth)
+static void WritePropertyValueAsJson(OutputBuffer& Out, UEProperty Prop, const uint8* RowData, int Depth)
 {
 	const int32 Offset = Prop.GetOffset();
 	const int32 Size = Prop.GetSize();
@@ -1131,6 +1132,9 @@ void DumpspaceGenerator::GenerateDataTables(const fs::path& DumperFolder)
 
 	int TableCount = 0;
 
+	/* Reused for all tables, so the buffer only grows to the size of the largest table */
+	OutputBuffer File;
+
 	for (UEObject Obj : ObjectArray())
 	{
 		if (!Obj.IsA(DataTableClass))
@@ -1154,8 +1158,7 @@ void DumpspaceGenerator::GenerateDataTables(const fs::path& DumperFolder)
 			FileNameHelper::MakeValidFileName(SafeTableName);
 			fs::path OutPath = DataTablesDir / (SafeTableName + ".json");
 
-			std::ofstream File(OutPath);
-			if (!File.is_open()) continue;
+			File.Clear();
 
 			/* JSON header */
 			File << "{\n";
@@ -1208,6 +1211,8 @@ void DumpspaceGenerator::GenerateDataTables(const fs::path& DumperFolder)
 			File << "  \"row_count\": " << RowCount << "\n";
 			File << "}\n";
 
+			if (!File.WriteToFile(OutPath)) continue;
+
 			TableCount++;
 		}
 		catch (const std::exception& e)
@@ -4,6 +4,8 @@
 #include "Managers/EnumManager.h"
 #include "Managers/MemberManager.h"
 #include "Managers/PackageManager.h"
+#include "Managers/DenseIndexManager.h"
+#include "Managers/IRManager.h"
 
 #include "HashStringTable.h"
 #include "Utils.h"
@@ -12,6 +14,8 @@
 #include "Json/json.hpp"
 
 #include <fstream>
+#include <future>
+#include <chrono>
 
 inline void InitSettings()
 {
@@ -77,20 +81,139 @@ void Generator::InitEngineCore()
 
 void Generator::InitInternal()
 {
-	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
-	PackageManager::Init();
-
-	// Initialize StructManager with all structs and their names
-	StructManager::Init();
-	
-	// Initialize EnumManager with all enums and their names
-	EnumManager::Init();
-	
-	// Initialized all Member-Name collisions
-	MemberManager::Init();
-
-	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
-	PackageManager::PostInit();
+	using Clock = std::chrono::high_resolution_clock;
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+
+	struct ManagerInitTask
+	{
+		const char* Name;
+		void(*InitFunction)();
+		std::future<double> Result;
+		double Time = 0.0;
+	};
+
+	static auto RunTimed = [](void(*InitFunction)()) -> double
+	{
+		const auto StartTime = Clock::now();
+		InitFunction();
+		return Milliseconds(Clock::now() - StartTime).count();
+	};
+
+	// Classifies all objects into structs, functions, enums and packages. Must be first, all other managers are initialized from these buckets
+	const double ClassificationTime = RunTimed(&DenseIndexManager::Init);
+
+	/*
+	* These managers don't depend on each other and only read from GObjects, so they are initialized in parallel:
+	* 
+	* PackageManager: all packages, their names, structs, classes enums, functions and dependencies
+	* StructManager:  all structs and their names, sizes and alignments
+	* EnumManager:    all enums and their names
+	* MemberManager:  all Member-Name collisions
+	*/
+	ManagerInitTask Tasks[] = {
+		{ "PackageManager", &PackageManager::Init },
+		{ "StructManager", &StructManager::Init },
+		{ "EnumManager", &EnumManager::Init },
+		{ "MemberManager", &MemberManager::Init },
+	};
+
+	for (ManagerInitTask& Task : Tasks)
+		Task.Result = std::async(std::launch::async, RunTimed, Task.InitFunction);
+
+	const ManagerInitTask* SlowestTask = nullptr;
+
+	for (ManagerInitTask& Task : Tasks)
+	{
+		Task.Time = Task.Result.get();
+
+		if (!SlowestTask || Task.Time > SlowestTask->Time)
+			SlowestTask = &Task;
+	}
+
+	/*
+	* These phases depend on the results of the previous ones and run sequentially:
+	*
+	* PackageManager::PostInit:          Cyclic-Dependencies detection, requires StructManager
+	* MemberManager::InitSortedMembers:  Sorts members and functions of all structs once, requires StructManager and MemberManager
+	*
+	* IRManager::Init runs later, before the first generator reading the IR. See Generator::Generate().
+	*/
+	std::pair<const char*, double> SequentialPhases[] = {
+		{ "PackageManager::PostInit", RunTimed(&PackageManager::PostInit) },
+		{ "MemberManager::InitSortedMembers", RunTimed(&MemberManager::InitSortedMembers) },
+	};
+
+	double CriticalPathTime = ClassificationTime + SlowestTask->Time;
+	std::string CriticalPath = std::format("Classification -> {}", SlowestTask->Name);
+
+	std::cerr << std::format("Manager initialization: Classification {:.2f}ms", ClassificationTime);
+
+	for (const ManagerInitTask& Task : Tasks)
+		std::cerr << std::format(", {} {:.2f}ms", Task.Name, Task.Time);
+
+	for (const auto& [Name, Time] : SequentialPhases)
+	{
+		std::cerr << std::format(", {} {:.2f}ms", Name, Time);
+
+		CriticalPath += std::format(" -> {}", Name);
+		CriticalPathTime += Time;
+	}
+
+	std::cerr << std::format("\nManager initialization critical path: {} ({:.2f}ms)\n\n", CriticalPath, CriticalPathTime);
+}
+
+bool Generator::InitFromIRFile(const fs::path& FilePath)
+{
+	if (!IRManager::LoadFromFile(FilePath))
+		return false;
+
+	/* Output goes into the folder of the dump that wrote the file */
+	Settings::Generator::GameName = IRManager::GetIR().GameName;
+	Settings::Generator::GameVersion = IRManager::GetIR().GameVersion;
+
+	/* There are no objects to dump without the game */
+	bDumpedGObjects = true;
+	bDumepdEditorOnlyMetadata = true;
+
+	return true;
+}
+
+void Generator::ClearFolder(const fs::path& Folder)
+{
+	if (!fs::exists(Folder))
+		return;
+
+	const fs::path Old = Folder.generic_string() + "_OLD";
+
+	std::error_code ec;
+
+	/* Deleting the previous backup can take a while, move it out of the way and delete it on a background thread */
+	if (fs::exists(Old))
+	{
+		const fs::path Trash = Folder.generic_string() + "_OLD_DELETE";
+
+		FileManifest::WaitForPendingDeletions();
+
+		fs::remove_all(Trash, ec);
+		fs::rename(Old, Trash, ec);
+
+		if (ec)
+		{
+			fs::remove_all(Old, ec);
+		}
+		else
+		{
+			FileManifest::RemoveInBackground(Trash);
+		}
+	}
+
+	fs::rename(Folder, Old, ec);
+
+	if (ec)
+	{
+		/* rename failed (locked by Explorer / AV / etc.) — clear in-place instead */
+		fs::remove_all(Folder, ec);
+	}
 }
 
 bool Generator::SetupDumperFolder()
@@ -103,20 +226,11 @@ bool Generator::SetupDumperFolder()
 
 		DumperFolder = fs::path(Settings::Generator::SDKGenerationPath) / FolderName;
 
-		if (fs::exists(DumperFolder))
-		{
-			fs::path Old = DumperFolder.generic_string() + "_OLD";
-
-			std::error_code ec;
-			fs::remove_all(Old, ec);
-			fs::rename(DumperFolder, Old, ec);
+		FileManifest::Init(DumperFolder);
 
-			if (ec)
-			{
-				/* rename failed (locked by Explorer / AV / etc.) — clear in-place instead */
-				fs::remove_all(DumperFolder, ec);
-			}
-		}
+		/* Without a manifest there's no way to tell which files are stale, start from an empty folder */
+		if (!FileManifest::HasPreviousFiles())
+			ClearFolder(DumperFolder);
 
 		fs::create_directories(DumperFolder);
 	}
@@ -147,19 +261,9 @@ bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder, std::
 		OutFolder = DumperFolder / FolderName;
 		OutSubFolder = OutFolder / SubfolderName;
 				
-		if (fs::exists(OutFolder))
-		{
-			fs::path Old = OutFolder.generic_string() + "_OLD";
-
-			std::error_code ec;
-			fs::remove_all(Old, ec);
-			fs::rename(OutFolder, Old, ec);
-
-			if (ec)
-			{
-				fs::remove_all(OutFolder, ec);
-			}
-		}
+		/* Folders of generators with files in the manifest are updated in place, see FileManifest */
+		if (!FileManifest::HasPreviousFiles(FolderName))
+			ClearFolder(OutFolder);
 
 		fs::create_directories(OutFolder);
 
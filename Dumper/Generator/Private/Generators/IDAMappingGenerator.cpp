@@ -1,6 +1,4 @@
 
-#include <fstream>
-
 #include "Generators/IDAMappingGenerator.h"
 
 
@@ -9,7 +7,7 @@ std::string IDAMappingGenerator::MangleFunctionName(const std::string& ClassName
 	return "_ZN" + std::to_string(ClassName.length()) + ClassName + std::to_string(FunctionName.length() + 4) + "exec" + FunctionName + "Ev";
 }
 
-void IDAMappingGenerator::WriteReadMe(StreamType& ReadMe)
+void IDAMappingGenerator::WriteReadMe(OutputBuffer& ReadMe)
 {
 	ReadMe << R"(
 /*
@@ -38,17 +36,15 @@ struct Identifier
 )";
 }
 
-void IDAMappingGenerator::GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject)
+void IDAMappingGenerator::GenerateVTableName(OutputBuffer& IdmapFile, const IRStruct& Class)
 {
-	const UEClass Class = DefaultObject.GetClass();
-	const UEClass Super = Class.GetSuper().Cast<UEClass>();
-
-	if (Super && DefaultObject.GetVft() == Super.GetDefaultObject().GetVft())
+	/* Classes sharing the VTable of their super-class don't have a VftOffset */
+	if (Class.VftOffset == 0x0)
 		return;
 
-	const std::string Name = Class.GetCppName() + "_VFT";
+	const std::string Name = Class.CppName + "_VFT";
 
-	const uint32 Offset = static_cast<uint32>(Platform::GetOffset(DefaultObject.GetVft()));
+	const uint32 Offset = Class.VftOffset;
 	const uint16 NameLen = static_cast<uint16>(Name.length());
 
 	WriteToStream(IdmapFile, Offset);
@@ -56,27 +52,23 @@ void IDAMappingGenerator::GenerateVTableName(StreamType& IdmapFile, UEObject Def
 	WriteToStream(IdmapFile, Name.c_str(), NameLen);
 }
 
-void IDAMappingGenerator::GenerateClassFunctions(StreamType& IdmapFile, UEClass Class)
+void IDAMappingGenerator::GenerateClassFunctions(OutputBuffer& IdmapFile, const SDKIR& IR, const IRStruct& Class, std::unordered_set<uint32>& NamedExecFunctions)
 {
-	static std::unordered_map<uint32, std::string> Funcs;
-
-	for (const UEFunction Func : Class.GetFunctions())
+	for (const int32 FuncIndex : IR.GetFunctionIndices(Class))
 	{
-		if (!Func.HasFlags(EFunctionFlags::Native))
-			continue;
+		const IRFunction& Func = IR.Functions[FuncIndex];
 
-		const std::string MangledName = MangleFunctionName(Class.GetCppName(), Func.GetValidName());
-
-		const uint32 Offset = static_cast<uint32>(Platform::GetOffset(Func.GetExecFunction()));
-		const uint16 NameLen = static_cast<uint16>(MangledName.length());
+		if (!(Func.FunctionFlags & EFunctionFlags::Native))
+			continue;
 
-		auto [It, bInseted] = Funcs.emplace(Offset, Func.GetFullName());
+		const uint32 Offset = Func.ExecFunctionOffset;
 
-		if (!bInseted)
-		{
-			//std::cerr << "Collision: \nOld: " << It->second << "\nNew: " << Func.GetFullName() << "\n" << std::endl;
+		/* Multiple functions can share one exec-function, only name it once */
+		if (!NamedExecFunctions.insert(Offset).second)
 			continue;
-		}
+
+		const std::string MangledName = MangleFunctionName(Class.CppName, Func.Name);
+		const uint16 NameLen = static_cast<uint16>(MangledName.length());
 
 		WriteToStream(IdmapFile, Offset);
 		WriteToStream(IdmapFile, NameLen);
@@ -90,26 +82,31 @@ void IDAMappingGenerator::Generate()
 
 	FileNameHelper::MakeValidFileName(IdaMappingFileName);
 
-	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-	std::ofstream IdmapFile(MainFolder / IdaMappingFileName, std::ios::binary);
+	OutputBuffer IdmapFile;
 
 	/* Create a ReadMe to describe what '.idmap' is, and how to use it */
-	std::ofstream ReadMe(MainFolder / "ReadMe.txt");
+	OutputBuffer ReadMe;
 
 	/* Write description of the file format, as well as a link to the IDA-Plugin */
 	WriteReadMe(ReadMe);
+	ReadMe.WriteToFile(MainFolder / "ReadMe.txt");
+
+	const SDKIR& IR = IRManager::GetIR();
 
-	for (UEObject Obj : ObjectArray())
+	std::unordered_set<uint32> NamedExecFunctions;
+
+	for (const IRStruct& Struct : IR.Structs)
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-		{
-			/* Gets the VTable offset from the default object and writes the ClassName + "_VFT" postfix to the file */
-			GenerateVTableName(IdmapFile, Obj);
-		}
-		else if (Obj.IsA(EClassCastFlags::Class))
-		{
-			/* Iterates all of the functions of the class and them to the stream with an "exec" prefix in front of the function name */
-			GenerateClassFunctions(IdmapFile, Obj.Cast<UEClass>());
-		}
+		if (!Struct.bIsClass)
+			continue;
+
+		/* Writes the VTable offset of the class with the ClassName + "_VFT" postfix to the file */
+		GenerateVTableName(IdmapFile, Struct);
+
+		/* Iterates all of the functions of the class and them to the stream with an "exec" prefix in front of the function name */
+		GenerateClassFunctions(IdmapFile, IR, Struct, NamedExecFunctions);
 	}
-}
\ No newline at end of file
+
+	/* Write the file as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
+	IdmapFile.WriteToFile(MainFolder / IdaMappingFileName, true);
+}
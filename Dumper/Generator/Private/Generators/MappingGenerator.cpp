@@ -1,20 +1,17 @@
 
 #include <iostream>
 #include <string>
+#include <format>
 
 #include "Generators/MappingGenerator.h"
-#include "Managers/PackageManager.h"
+#include "Managers/IRManager.h"
 #include "Compression/zstd.h"
 
 #include "../Settings.h"
 #include "Utils.h"
 
-EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
+EMappingsTypeFlags MappingGenerator::GetMappingType(EClassCastFlags Flags)
 {
-	auto [Class, FieldClass] = Property.GetClass();
-
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
-
 	if (Flags & EClassCastFlags::ByteProperty)
 	{
 		return EMappingsTypeFlags::ByteProperty;
@@ -151,19 +148,17 @@ EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 	return EMappingsTypeFlags::Unknown;
 }
 
-int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+int32 MappingGenerator::AddNameToData(OutputBuffer& NameTable, const std::string& Name)
 {
 	if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
 	{
-		static std::unordered_map<std::string, int32> NameMap;
-		
-		auto [It, bInserted] = NameMap.insert({ Name, NameCounter });
+		auto [It, bInserted] = NameIndices.insert({ Name, static_cast<int32>(NameCounter) });
 
 		/* The name didn't occure yet, write it to the NameTable */
 		if (bInserted)
 		{
 			WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-			NameTable.write(Name.c_str(), Name.length());
+			NameTable.Write(Name.c_str(), Name.length());
 			return NameCounter++;
 		}
 
@@ -171,23 +166,27 @@ int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::s
 	}
 
 	WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-	NameTable.write(Name.c_str(), Name.length());
+	NameTable.Write(Name.c_str(), Name.length());
 
 	return NameCounter++;
 }
 
-void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GeneratePropertyType(const SDKIR& IR, int32 TypeIndex, OutputBuffer& Data, OutputBuffer& NameTable)
 {
-	if (!Property)
+	const IRPropertyType* Type = IR.GetPropertyType(TypeIndex);
+
+	if (!Type)
 	{
 		WriteToStream(Data, static_cast<uint8>(EMappingsTypeFlags::Unknown));
 		return;
 	}
 
-	EMappingsTypeFlags MappingType = GetMappingType(Property);
+	EMappingsTypeFlags MappingType = GetMappingType(Type->CastFlags);
+
+	const IREnum* ReferencedEnum = IR.GetReferencedEnum(*Type);
 
 	/* Serialize ByteProperty as an EnumProperty with 'UnderlayingType == uint8' if the inner enum is valid */
-	const bool bIsFakeEnumProperty = MappingType == EMappingsTypeFlags::ByteProperty && Property.Cast<UEByteProperty>().GetEnum();
+	const bool bIsFakeEnumProperty = MappingType == EMappingsTypeFlags::ByteProperty && ReferencedEnum;
 
 	WriteToStream(Data, static_cast<uint8>(!bIsFakeEnumProperty ? MappingType : EMappingsTypeFlags::EnumProperty));
 
@@ -197,74 +196,56 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 
 	if (MappingType == EMappingsTypeFlags::EnumProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data, NameTable);
+		GeneratePropertyType(IR, Type->InnerTypes[0], Data, NameTable);
 
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = AddNameToData(NameTable, ReferencedEnum ? ReferencedEnum->RawName : std::string());
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (bIsFakeEnumProperty)
 	{
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = AddNameToData(NameTable, ReferencedEnum->RawName);
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (MappingType == EMappingsTypeFlags::StructProperty)
 	{
-		const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetName());
+		const IRStruct* ReferencedStruct = IR.GetReferencedStruct(*Type);
+
+		const int32 StructNameIdx = AddNameToData(NameTable, ReferencedStruct ? ReferencedStruct->RawName : std::string());
 		WriteToStream(Data, StructNameIdx);
 	}
-	else if (MappingType == EMappingsTypeFlags::SetProperty)
-	{
-		GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Data, NameTable);
-	}
-	else if (MappingType == EMappingsTypeFlags::ArrayProperty)
+	else if (MappingType == EMappingsTypeFlags::SetProperty || MappingType == EMappingsTypeFlags::ArrayProperty || MappingType == EMappingsTypeFlags::OptionalProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Data, NameTable);
-	}
-	else if (MappingType == EMappingsTypeFlags::OptionalProperty)
-	{
-		GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(IR, Type->InnerTypes[0], Data, NameTable);
 	}
 	else if (MappingType == EMappingsTypeFlags::MapProperty)
 	{
-		UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
-		GeneratePropertyType(AsMapProperty.GetKeyProperty(), Data, NameTable);
-		GeneratePropertyType(AsMapProperty.GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(IR, Type->InnerTypes[0], Data, NameTable);
+		GeneratePropertyType(IR, Type->InnerTypes[1], Data, NameTable);
 	}
 }
 
-void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index)
+void MappingGenerator::GeneratePropertyInfo(const SDKIR& IR, const IRMember& Property, OutputBuffer& Data, OutputBuffer& NameTable, int32& Index)
 {
-	if (!Property.IsUnrealProperty())
-	{
-		std::cerr << "\nInvalid non-Unreal property!\n" << std::endl;
-		return;
-	}
-
 	WriteToStream(Data, static_cast<uint16>(Index));
-	WriteToStream(Data, static_cast<uint8>(Property.GetArrayDim()));
+	WriteToStream(Data, static_cast<uint8>(Property.ArrayDim));
 
-	const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetName());
+	const int32 MemberNameIdx = AddNameToData(NameTable, Property.RawName);
 	WriteToStream(Data, MemberNameIdx);
 
-	GeneratePropertyType(Property.GetUnrealProperty(), Data, NameTable);
+	GeneratePropertyType(IR, Property.TypeIndex, Data, NameTable);
 
-	Index += Property.GetArrayDim();
+	Index += Property.ArrayDim;
 }
 
-void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateStruct(const SDKIR& IR, const IRStruct& Struct, OutputBuffer& Data, OutputBuffer& NameTable)
 {
-	if (!Struct.IsValid())
-		return;
-
-	const int32 StructNameIndex = AddNameToData(NameTable, Struct.GetRawName());
+	const int32 StructNameIndex = AddNameToData(NameTable, Struct.RawName);
 	WriteToStream(Data, StructNameIndex);
 
-	StructWrapper Super = Struct.GetSuper();
-
-	if (Super.IsValid())
+	if (const IRStruct* Super = IR.GetSuper(Struct))
 	{
 		/* Most likely adds a duplicate to the name-table. Find a better solution later! */
-		const int32 SuperNameIndex = AddNameToData(NameTable, Super.GetRawName());
+		const int32 SuperNameIndex = AddNameToData(NameTable, Super->RawName);
 		WriteToStream(Data, SuperNameIndex);
 	}
 	else
@@ -272,19 +253,19 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 		WriteToStream(Data, static_cast<int32>(-1));
 	}
 
-	MemberManager Members = Struct.GetMembers();
+	const std::span<const IRMember> Members = IR.GetMembers(Struct);
 
 	uint16 PropertyCount = 0x0;
 	uint16 SerializablePropertyCount = 0x0;
 	constexpr auto ExcludeEditorOnlyProps = Settings::MappingGenerator::bExcludeEditorOnlyProperties;
 
-	for (const PropertyWrapper& Member : Members.IterateMembers())
+	for (const IRMember& Member : Members)
 	{
-		if (ExcludeEditorOnlyProps && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
+		if (ExcludeEditorOnlyProps && (Member.PropertyFlags & EPropertyFlags::EditorOnly))
 			continue;
 
 		SerializablePropertyCount++;
-		PropertyCount += Member.GetArrayDim();
+		PropertyCount += Member.ArrayDim;
 	}
 
 	/* uint16, uint16 */
@@ -294,87 +275,76 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 	/* Incremented by 'Property->ArrayDim' inside 'GeneratePropertyInfo()' */
 	int32 IndexIncrementedByFunction = 0x0;
 
-	for (const PropertyWrapper& Member : Members.IterateMembers())
+	for (const IRMember& Member : Members)
 	{
-		if (ExcludeEditorOnlyProps && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
+		if (ExcludeEditorOnlyProps && (Member.PropertyFlags & EPropertyFlags::EditorOnly))
 			continue;
 
-		GeneratePropertyInfo(Member, Data, NameTable, IndexIncrementedByFunction);
+		GeneratePropertyInfo(IR, Member, Data, NameTable, IndexIncrementedByFunction);
 	}
 }
 
-void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateEnum(const SDKIR& IR, const IREnum& Enum, OutputBuffer& Data, OutputBuffer& NameTable)
 {
-	const int32 EnumNameIndex = AddNameToData(NameTable, Enum.GetRawName());
+	const int32 EnumNameIndex = AddNameToData(NameTable, Enum.RawName);
 	WriteToStream(Data, EnumNameIndex);
 
-	WriteToStream(Data, static_cast<uint16>(Enum.GetNumMembers()));
+	WriteToStream(Data, static_cast<uint16>(Enum.NumMembers));
 
-	for (EnumCollisionInfo Member : Enum.GetMembers())
+	for (const IREnumMember& Member : IR.GetMembers(Enum))
 	{
-		const int32 EnumMemberNameIdx = AddNameToData(NameTable, Member.GetUniqueName());
-		WriteToStream(Data, Member.GetValue());
+		const int32 EnumMemberNameIdx = AddNameToData(NameTable, Member.UniqueName);
+		WriteToStream(Data, Member.Value);
 		WriteToStream(Data, EnumMemberNameIdx);
 	}
 }
 
-std::stringstream MappingGenerator::GenerateFileData()
+OutputBuffer MappingGenerator::GenerateFileData(const SDKIR& IR)
 {
-	std::stringstream NameData;
-	std::stringstream StructData;
-	std::stringstream EnumData;
+	NameCounter = 0x0;
+	NameIndices.clear();
+
+	OutputBuffer NameData;
+	OutputBuffer StructData;
+	OutputBuffer EnumData;
 
 	uint32 NumEnums = 0x0;
 	uint32 NumStructsAndClasse = 0x0;
 
 	/* Handle all Enums first */
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	for (const IRPackage& Package : IR.Packages)
 	{
-		if (Package.IsEmpty())
+		if (Package.bIsEmpty)
 			continue;
 
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasEnums())
-			continue;
-
-		for (int32 EnumIdx : Package.GetEnums())
+		for (const int32 EnumIdx : Package.Enums)
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), EnumData, NameData);
+			GenerateEnum(IR, IR.Enums[EnumIdx], EnumData, NameData);
 			NumEnums++;
 		}
 	}
 	
 	/* Handle all structs and classes in one go. From the mapping-files point of view classes are the exact same as structs. */
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	for (const IRPackage& Package : IR.Packages)
 	{
-		if (Package.IsEmpty())
-			continue;
-
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasClasses() && !Package.HasStructs())
+		if (Package.bIsEmpty)
 			continue;
 
-		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
+		for (const int32 StructIdx : Package.SortedStructs)
 		{
-			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructData, NameData);
+			GenerateStruct(IR, IR.Structs[StructIdx], StructData, NameData);
 			NumStructsAndClasse++;
-		};
-
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
 		}
 
-		if (Package.HasClasses())
+		for (const int32 ClassIdx : Package.SortedClasses)
 		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
-			Classes.VisitAllNodesWithCallback(GenerateStructCallback);
+			GenerateStruct(IR, IR.Structs[ClassIdx], StructData, NameData);
+			NumStructsAndClasse++;
 		}
 	}
 
-	/* Combine all of the stringstreams into one Data block representing the entire payload of the file */
-	std::stringstream ReturnBuffer;
+	/* Combine all of the buffers into one Data block representing the entire payload of the file */
+	OutputBuffer ReturnBuffer(NameData.Size() + EnumData.Size() + StructData.Size() + (sizeof(uint32) * 3));
 
 	/* Write Name-count and names */
 	WriteToStream(ReturnBuffer, static_cast<uint32>(NameCounter));
@@ -401,7 +371,7 @@ std::stringstream MappingGenerator::GenerateFileData()
 }
 
 
-void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data)
+void MappingGenerator::GenerateFileHeader(OutputBuffer& InUsmap, const OutputBuffer& Data)
 {
 	/* Write 2bytes unsigned */
 	WriteToStream(InUsmap, UsmapFileMagic);
@@ -412,7 +382,7 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	/* We're on 'ExplicitEnumValues' version, we need to write 'bool' (aka int32) bHasVersioning. (NoVersioning = false) -> no [int32 UE4Version, int32 UE5Version] and no [uint32 NetCL] */
 	WriteToStream(InUsmap, static_cast<int32>(false));
 
-	const uint32 UncompressedSize = static_cast<uint32>(Data.str().length());
+	const uint32 UncompressedSize = static_cast<uint32>(Data.Size());
 
 	constexpr auto CompressionMethod = Settings::MappingGenerator::CompressionMethod;
 
@@ -427,11 +397,11 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	case EUsmapCompressionMethod::ZStandard:
 		CompressedSize = ZSTD_compressBound(UncompressedSize);
 		CompressedBuffer = malloc(CompressedSize);
-		CompressedSize = ZSTD_compress(CompressedBuffer, CompressedSize, Data.str().data(), UncompressedSize, ZSTD_maxCLevel());
+		CompressedSize = ZSTD_compress(CompressedBuffer, CompressedSize, Data.View().data(), UncompressedSize, ZSTD_maxCLevel());
 		break;
 	default:
 		CompressedBuffer = malloc(CompressedSize);
-		memcpy(CompressedBuffer, Data.str().data(), CompressedSize);
+		memcpy(CompressedBuffer, Data.View().data(), CompressedSize);
 		break;
 	}
 
@@ -448,26 +418,25 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	WriteToStream(InUsmap, UncompressedSize);
 
 	/* Header is done, now write the payload to the file */
-	InUsmap.write(static_cast<const char*>(CompressedBuffer), static_cast<uint32>(CompressedSize));
+	InUsmap.Write(CompressedBuffer, CompressedSize);
 
 	free(CompressedBuffer);
 }
 
 void MappingGenerator::Generate()
 {
-	NameCounter = 0x0;
-
 	std::string MappingsFileName = (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName + ".usmap");
 
 	FileNameHelper::MakeValidFileName(MappingsFileName);
 
-	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-	std::ofstream UsmapFile(MainFolder / MappingsFileName, std::ios::binary);
-
 	/* Generate the payload of the file, containing all of the names, enums and structs. */
-	std::stringstream FileData = GenerateFileData();
+	OutputBuffer FileData = GenerateFileData(IRManager::GetIR());
 
-	/* Generate the header, and write both header and payload into the file. */
+	/* Generate the header, and write both header and payload into the buffer. */
+	OutputBuffer UsmapFile;
 	GenerateFileHeader(UsmapFile, FileData);
+
+	/* Write the file as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
+	UsmapFile.WriteToFile(MainFolder / MappingsFileName, true);
 }
 
@@ -0,0 +1,285 @@
+
+#include <iostream>
+#include <format>
+#include <algorithm>
+#include <unordered_set>
+
+#include "Generators/OffsetsGenerator.h"
+#include "OffsetFinder/Offsets.h"
+
+#include "../Settings.h"
+
+
+void OffsetsGenerator::WriteFileHead(OutputBuffer& File, const std::string& FileComment)
+{
+	File.Format(R"(#pragma once
+
+/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+
+// {}
+// {}
+
+// {}
+
+)", Settings::Generator::GameName, Settings::Generator::GameVersion, FileComment);
+}
+
+void OffsetsGenerator::GenerateBasicFile(OutputBuffer& BasicFile)
+{
+	WriteFileHead(BasicFile, "Typedefs and global offsets");
+
+	std::string GetNameEntryFromNameOffsetText;
+
+	if (Off::InSDK::Name::bIsAppendStringInlinedAndUsed)
+		GetNameEntryFromNameOffsetText = std::format("\n	constexpr int32 GetNameEntry      = 0x{:08X};", Off::InSDK::Name::GetNameEntryFromName);
+
+	/* Same values as the 'Offsets' namespace in the Basic.hpp of the C++ SDK */
+	BasicFile.Format(R"(#include <cstdint>
+
+namespace SDKOffsets
+{{
+
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+
+/* Offsets from the image-base, and indices into VTables */
+namespace Offsets
+{{
+	constexpr int32 GObjects          = 0x{:08X};
+	constexpr int32 AppendString      = 0x{:08X};{}
+	constexpr int32 GNames            = 0x{:08X};
+	constexpr int32 GWorld            = 0x{:08X};
+	constexpr int32 ProcessEvent      = 0x{:08X};
+	constexpr int32 ProcessEventIdx   = 0x{:08X};
+	constexpr int32 GVCPostRenderIdx  = 0x{:08X};
+	constexpr int32 HUDPostRenderIdx  = 0x{:08X};
+}}
+
+}}
+)", std::max(Off::InSDK::ObjArray::GObjects, 0x0),
+	std::max(Off::InSDK::Name::AppendNameToString, 0x0),
+	GetNameEntryFromNameOffsetText,
+	std::max(Off::InSDK::NameArray::GNames, 0x0),
+	std::max(Off::InSDK::World::GWorld, 0x0),
+	std::max(Off::InSDK::ProcessEvent::PEOffset, 0x0),
+	Off::InSDK::ProcessEvent::PEIndex,
+	Off::InSDK::PostRender::GVCPostRenderIndex,
+	Off::InSDK::PostRender::HUDPostRenderIndex);
+}
+
+void OffsetsGenerator::GeneratePredefinedMembers(OutputBuffer& PackageFile, const IRStruct& Struct)
+{
+	using PredefinedOffset = std::pair<const char*, int32>;
+
+	std::vector<PredefinedOffset> Offsets;
+
+	if (Struct.RawName == "Object")
+	{
+		Offsets = { { "Vft", Off::UObject::Vft }, { "Flags", Off::UObject::Flags }, { "Index", Off::UObject::Index }, { "Class", Off::UObject::Class }, { "Name", Off::UObject::Name }, { "Outer", Off::UObject::Outer } };
+	}
+	else if (Struct.RawName == "Field")
+	{
+		Offsets = { { "Next", Off::UField::Next } };
+	}
+	else if (Struct.RawName == "Struct")
+	{
+		Offsets = { { "SuperStruct", Off::UStruct::SuperStruct }, { "Children", Off::UStruct::Children }, { "Size", Off::UStruct::Size }, { "MinAlignment", Off::UStruct::MinAlignment } };
+
+		if (Settings::Internal::bUseFProperty)
+			Offsets.emplace_back("ChildProperties", Off::UStruct::ChildProperties);
+	}
+	else if (Struct.RawName == "Function")
+	{
+		Offsets = { { "FunctionFlags", Off::UFunction::FunctionFlags }, { "ExecFunction", Off::UFunction::ExecFunction } };
+	}
+	else if (Struct.RawName == "Class")
+	{
+		Offsets = { { "CastFlags", Off::UClass::CastFlags }, { "ClassDefaultObject", Off::UClass::ClassDefaultObject } };
+	}
+	else if (Struct.RawName == "Enum")
+	{
+		Offsets = { { "Names", Off::UEnum::Names } };
+	}
+
+	if (Offsets.empty())
+		return;
+
+	PackageFile << "\n";
+
+	for (const auto& [Name, Offset] : Offsets)
+	{
+		/* Offsets that weren't found for this engine-version, only the VTable is at 0x0 */
+		if (Offset < 0x0 || (Offset == 0x0 && std::string_view(Name) != "Vft"))
+			continue;
+
+		PackageFile.Format("\tconstexpr int32 {:{}} = 0x{:04X}; // Predefined\n", Name, 40, Offset);
+	}
+}
+
+void OffsetsGenerator::GenerateStruct(OutputBuffer& PackageFile, const SDKIR& IR, const IRStruct& Struct)
+{
+	static const std::unordered_set<std::string> ReservedNames = {
+		"StructSize", "StructAlignment", "SuperSize", "Functions",
+	};
+
+	const IRStruct* Super = IR.GetSuper(Struct);
+	const int32 SuperSize = Super ? Super->Size : 0x0;
+
+	PackageFile.Format(R"(
+// {} {}.{}
+// 0x{:04X} (0x{:04X} - 0x{:04X})
+namespace {}
+{{
+	constexpr int32 StructSize = 0x{:04X};
+	constexpr int32 StructAlignment = 0x{:04X};
+	constexpr int32 SuperSize = 0x{:04X};
+)", Struct.bIsClass ? "Class" : "ScriptStruct", IR.Packages[Struct.PackageIndex].Name, Struct.RawName
+  , Struct.Size - SuperSize, Struct.Size, SuperSize
+  , Struct.UniqueName
+  , Struct.Size
+  , Struct.Alignment
+  , SuperSize);
+
+	if (Struct.bIsClass && IR.Packages[Struct.PackageIndex].Name == "CoreUObject")
+		GeneratePredefinedMembers(PackageFile, Struct);
+
+	std::span<const IRMember> Members = IR.GetMembers(Struct);
+
+	if (!Members.empty())
+		PackageFile << "\n";
+
+	for (const IRMember& Member : Members)
+	{
+		const std::string Name = ReservedNames.contains(Member.UniqueName) ? (Member.UniqueName + "_") : Member.UniqueName;
+
+		if (Member.bIsBitField)
+		{
+			PackageFile.Format("\tconstexpr int32 {:{}} = 0x{:04X}; // BitIndex: 0x{:02X}\n", Name, 40, Member.Offset, Member.BitIndex);
+			PackageFile.Format("\tconstexpr uint8 {:{}} = 0x{:02X};\n", Name + "_FieldMask", 40, Member.FieldMask);
+			continue;
+		}
+
+		if (Member.ArrayDim > 0x1)
+		{
+			PackageFile.Format("\tconstexpr int32 {:{}} = 0x{:04X}; // 0x{:04X}[0x{:X}]\n", Name, 40, Member.Offset, Member.Size, Member.ArrayDim);
+			continue;
+		}
+
+		PackageFile.Format("\tconstexpr int32 {:{}} = 0x{:04X}; // 0x{:04X}\n", Name, 40, Member.Offset, Member.Size);
+	}
+
+	std::string FunctionString;
+
+	for (const int32 FunctionIndex : IR.GetFunctionIndices(Struct))
+	{
+		const IRFunction& Func = IR.Functions[FunctionIndex];
+
+		if (!(Func.FunctionFlags & EFunctionFlags::Native) || Func.ExecFunctionOffset == 0x0)
+			continue;
+
+		FunctionString += std::format("\t\tconstexpr uint32 {:{}} = 0x{:08X};\n", Func.UniqueName, 36, Func.ExecFunctionOffset);
+	}
+
+	if (!FunctionString.empty())
+	{
+		PackageFile.Format(R"(
+	/* Exec-functions of native functions, offsets from the image-base */
+	namespace Functions
+	{{
+{}	}}
+)", FunctionString);
+	}
+
+	PackageFile << "}\n";
+}
+
+void OffsetsGenerator::GeneratePackage(OutputBuffer& PackageFile, const SDKIR& IR, const IRPackage& Package)
+{
+	WriteFileHead(PackageFile, "Package: " + Package.Name);
+
+	PackageFile << "#include \"Basic.hpp\"\n\nnamespace SDKOffsets\n{\n";
+
+	bool bHasNameCollisions = false;
+
+	/* Structs with names used in several packages go into a namespace of the package, like in the C++ SDK */
+	for (const bool bIsUniqueNamePass : { true, false })
+	{
+		for (const std::vector<int32>* Structs : { &Package.SortedStructs, &Package.SortedClasses })
+		{
+			for (const int32 StructIndex : *Structs)
+			{
+				const IRStruct& Struct = IR.Structs[StructIndex];
+
+				if (Struct.bIsUniqueName != bIsUniqueNamePass)
+					continue;
+
+				if (!bIsUniqueNamePass && !bHasNameCollisions)
+				{
+					PackageFile.Format("\nnamespace {}\n{{\n", Package.Name);
+					bHasNameCollisions = true;
+				}
+
+				GenerateStruct(PackageFile, IR, Struct);
+			}
+		}
+	}
+
+	if (bHasNameCollisions)
+		PackageFile << "\n}\n";
+
+	PackageFile << "\n}\n";
+}
+
+void OffsetsGenerator::Generate()
+{
+	const SDKIR& IR = IRManager::GetIR();
+
+	OutputBuffer BasicFile(0x1000);
+	GenerateBasicFile(BasicFile);
+
+	if (!BasicFile.WriteToFile(Subfolder / "Basic.hpp"))
+		std::cerr << "OffsetsGenerator: Failed to write 'Basic.hpp'!\n";
+
+	OutputBuffer SdkFile(0x4000);
+	WriteFileHead(SdkFile, "Includes the offsets of all packages. Include files directly for faster compilation!");
+
+	SdkFile << "#include \"Offsets/Basic.hpp\"\n\n";
+
+	int32 NumGeneratedPackages = 0x0;
+
+	for (const IRPackage& Package : IR.Packages)
+	{
+		if (Package.bIsEmpty || (Package.SortedStructs.empty() && Package.SortedClasses.empty()))
+			continue;
+
+		OutputBuffer PackageFile;
+		GeneratePackage(PackageFile, IR, Package);
+
+		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.Name + ".hpp";
+
+		if (!PackageFile.WriteToFile(Subfolder / reinterpret_cast<const std::u8string&>(FileName)))
+		{
+			std::cerr << std::format("OffsetsGenerator: Failed to write '{}'!\n", FileName);
+			continue;
+		}
+
+		SdkFile.Format("#include \"Offsets/{}\"\n", FileName);
+		NumGeneratedPackages++;
+	}
+
+	if (!SdkFile.WriteToFile(MainFolder / "SDKOffsets.hpp"))
+		std::cerr << "OffsetsGenerator: Failed to write 'SDKOffsets.hpp'!\n";
+
+	std::cerr << std::format("OffsetsGenerator: Generated offsets of {} packages.\n", NumGeneratedPackages);
+}
@@ -0,0 +1,1171 @@
+
+#include <iostream>
+#include <format>
+#include <unordered_set>
+
+#include "Generators/RemoteSDKGenerator.h"
+#include "OffsetFinder/Offsets.h"
+
+#include "../Settings.h"
+
+
+static const char* GetIntegralTypeFromSize(int32 Size, bool bIsSigned)
+{
+	switch (Size)
+	{
+	case 0x1:
+		return bIsSigned ? "int8" : "uint8";
+	case 0x2:
+		return bIsSigned ? "int16" : "uint16";
+	case 0x4:
+		return bIsSigned ? "int32" : "uint32";
+	case 0x8:
+		return bIsSigned ? "int64" : "uint64";
+	default:
+		return nullptr;
+	}
+}
+
+std::string RemoteSDKGenerator::GetStructName(const SDKIR& IR, const IRStruct& Struct)
+{
+	if (Struct.bIsUniqueName) [[likely]]
+		return Struct.UniqueName;
+
+	/* All views are in one namespace, Package_FStructName */
+	return IR.Packages[Struct.PackageIndex].Name + "_" + Struct.UniqueName;
+}
+
+std::string RemoteSDKGenerator::GetEnumName(const SDKIR& IR, const IREnum& Enum)
+{
+	if (Enum.bIsUniqueName) [[likely]]
+		return Enum.UniqueName;
+
+	const int32 PackageIndex = EnumPackageIndices[&Enum - IR.Enums.data()];
+
+	/* Package_ESomeEnum */
+	return PackageIndex >= 0 ? (IR.Packages[PackageIndex].Name + "_" + Enum.UniqueName) : Enum.UniqueName;
+}
+
+int32 RemoteSDKGenerator::GetReferencedStructIndex(const SDKIR& IR, int32 TypeIndex)
+{
+	const IRPropertyType* Type = IR.GetPropertyType(TypeIndex);
+
+	if (!Type || !(Type->CastFlags & EClassCastFlags::StructProperty))
+		return -1;
+
+	return Type->ReferencedStructIndex;
+}
+
+bool RemoteSDKGenerator::HasUnresolvedReference(const SDKIR& IR, int32 TypeIndex)
+{
+	const IRPropertyType* Type = IR.GetPropertyType(TypeIndex);
+
+	if (!Type)
+		return false;
+
+	if (Type->CastFlags & EClassCastFlags::StructProperty)
+		return !IR.GetReferencedStruct(*Type);
+
+	if (Type->CastFlags & EClassCastFlags::EnumProperty)
+		return !IR.GetReferencedEnum(*Type);
+
+	if (Type->CastFlags & EClassCastFlags::ArrayProperty)
+		return HasUnresolvedReference(IR, Type->InnerTypes[0]);
+
+	return false;
+}
+
+int32 RemoteSDKGenerator::FindClassStructIndex(const SDKIR& IR, const IRStruct& ObjectStruct)
+{
+	/* UClass is declared in the same package as UObject */
+	for (int32 i = 0; i < static_cast<int32>(IR.Structs.size()); i++)
+	{
+		const IRStruct& Struct = IR.Structs[i];
+
+		if (Struct.bIsClass && Struct.PackageIndex == ObjectStruct.PackageIndex && Struct.RawName == "Class")
+			return i;
+	}
+
+	return -1;
+}
+
+std::string RemoteSDKGenerator::GetAccessorType(const SDKIR& IR, int32 TypeIndex, int32 Size)
+{
+	const IRPropertyType* Type = IR.GetPropertyType(TypeIndex);
+
+	if (!Type)
+		return "";
+
+	const EClassCastFlags Flags = Type->CastFlags;
+
+	auto GetEnumOrIntegralType = [&](bool bIsByteProperty) -> std::string
+	{
+		if (const IREnum* Enum = IR.GetReferencedEnum(*Type))
+		{
+			/* Size is 0 for inner-types of containers, the enum's own size is used then */
+			if ((bIsByteProperty && Enum->UnderlyingTypeSize == 0x1) || (!bIsByteProperty && (Size == 0x0 || Size == Enum->UnderlyingTypeSize)))
+				return GetEnumName(IR, *Enum);
+		}
+
+		const char* IntegralType = GetIntegralTypeFromSize(bIsByteProperty ? 0x1 : Size, false);
+
+		return IntegralType ? IntegralType : "";
+	};
+
+	if (Flags & EClassCastFlags::ByteProperty)
+	{
+		return GetEnumOrIntegralType(true);
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		return GetEnumOrIntegralType(false);
+	}
+	else if (Flags & EClassCastFlags::UInt16Property)
+	{
+		return "uint16";
+	}
+	else if (Flags & EClassCastFlags::UInt32Property)
+	{
+		return "uint32";
+	}
+	else if (Flags & EClassCastFlags::UInt64Property)
+	{
+		return "uint64";
+	}
+	else if (Flags & EClassCastFlags::Int8Property)
+	{
+		return "int8";
+	}
+	else if (Flags & EClassCastFlags::Int16Property)
+	{
+		return "int16";
+	}
+	else if (Flags & EClassCastFlags::IntProperty)
+	{
+		return "int32";
+	}
+	else if (Flags & EClassCastFlags::Int64Property)
+	{
+		return "int64";
+	}
+	else if (Flags & EClassCastFlags::FloatProperty)
+	{
+		return "float";
+	}
+	else if (Flags & EClassCastFlags::DoubleProperty)
+	{
+		return "double";
+	}
+	else if (Flags & EClassCastFlags::BoolProperty)
+	{
+		return "bool";
+	}
+	else if (Flags & EClassCastFlags::NameProperty)
+	{
+		return "FName";
+	}
+	else if (Flags & EClassCastFlags::StrProperty)
+	{
+		return "FRemoteString";
+	}
+	else if ((Flags & (EClassCastFlags::ObjectProperty | EClassCastFlags::ClassProperty))
+		&& !(Flags & (EClassCastFlags::WeakObjectProperty | EClassCastFlags::LazyObjectProperty | EClassCastFlags::SoftObjectProperty)))
+	{
+		/* The IR doesn't store the class of object properties, every reference is a pointer to a UObject that can be cast */
+		return (Size == 0x0 || Size == 0x8) ? "TRemotePtr<class UObject>" : "";
+	}
+	else if (Flags & EClassCastFlags::StructProperty)
+	{
+		const int32 StructIndex = GetReferencedStructIndex(IR, TypeIndex);
+
+		return StructIndex >= 0 ? GetStructName(IR, IR.Structs[StructIndex]) : "";
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		const std::string InnerType = GetAccessorType(IR, Type->InnerTypes[0], 0x0);
+
+		return !InnerType.empty() ? ("TRemoteArray<" + InnerType + ">") : "";
+	}
+
+	/* Maps, sets, texts, delegates, weak and soft references */
+	return "";
+}
+
+std::vector<int32> RemoteSDKGenerator::GetSortedStructs(const SDKIR& IR)
+{
+	std::vector<int32> SortedStructs;
+	SortedStructs.reserve(IR.Structs.size());
+
+	std::vector<bool> bWasVisited(IR.Structs.size(), false);
+
+	auto Visit = [&](auto&& Self, int32 StructIndex) -> void
+	{
+		if (StructIndex < 0 || bWasVisited[StructIndex])
+			return;
+
+		bWasVisited[StructIndex] = true;
+
+		const IRStruct& Struct = IR.Structs[StructIndex];
+
+		Self(Self, Struct.SuperIndex);
+
+		for (const IRMember& Member : IR.GetMembers(Struct))
+			Self(Self, GetReferencedStructIndex(IR, Member.TypeIndex));
+
+		SortedStructs.push_back(StructIndex);
+	};
+
+	for (int32 i = 0; i < static_cast<int32>(IR.Structs.size()); i++)
+		Visit(Visit, i);
+
+	return SortedStructs;
+}
+
+void RemoteSDKGenerator::GenerateEnum(OutputBuffer& SdkFile, const SDKIR& IR, const IREnum& Enum)
+{
+	std::string MemberString;
+
+	for (const IREnumMember& Member : IR.GetMembers(Enum))
+		MemberString += std::format("\t{:{}} = {},\n", Member.UniqueName, 40, Member.Value);
+
+	if (!MemberString.empty()) [[likely]]
+		MemberString.pop_back();
+
+	const char* UnderlyingType = GetIntegralTypeFromSize(Enum.UnderlyingTypeSize, false);
+
+	SdkFile.Format(R"(
+// {}
+enum class {} : {}
+{{
+{}
+}};
+)", Enum.RawName
+  , GetEnumName(IR, Enum)
+  , UnderlyingType ? UnderlyingType : "uint8"
+  , MemberString);
+}
+
+void RemoteSDKGenerator::GenerateStruct(OutputBuffer& SdkFile, const SDKIR& IR, const IRStruct& Struct)
+{
+	static const std::unordered_set<std::string> ReservedNames = {
+		"Get", "GetBit", "ReadBytes", "GetAddress", "GetContext", "IsValid", "StructSize",
+	};
+
+	const std::string StructName = GetStructName(IR, Struct);
+	const IRStruct* Super = IR.GetSuper(Struct);
+
+	const bool bIsUObject = Struct.bIsClass && !Super && Struct.RawName == "Object";
+
+	const std::string SuperName = Super ? GetStructName(IR, *Super) : "FRemoteStruct";
+
+	SdkFile.Format(R"(
+// {}
+// 0x{:04X} (0x{:04X} - 0x{:04X})
+class {} : public {}
+{{
+public:
+	static constexpr int32 StructSize = 0x{:04X};
+
+public:
+	using {}::{};
+
+	{}() = default;
+
+	{}(FRemoteContext* Context, uint64 Address)
+		: {}(Context, Address, StructSize)
+	{{
+	}}
+)", Struct.RawName
+  , Struct.Size - (Super ? Super->Size : 0x0), Struct.Size, Super ? Super->Size : 0x0
+  , StructName, SuperName
+  , Struct.Size
+  , SuperName, SuperName
+  , StructName
+  , StructName
+  , SuperName);
+
+	if (bIsUObject)
+	{
+		const int32 ClassIndex = FindClassStructIndex(IR, Struct);
+		const std::string ClassName = ClassIndex >= 0 ? GetStructName(IR, IR.Structs[ClassIndex]) : StructName;
+
+		SdkFile.Format(R"(
+public:
+	inline int32 Index() const {{ return Get<int32>(Offsets::UObjectIndex); }}
+	inline int32 Flags() const {{ return Get<int32>(Offsets::UObjectFlags); }}
+	inline TRemotePtr<class {}> Class() const {{ return Get<TRemotePtr<class {}>>(Offsets::UObjectClass); }}
+	inline FName Name() const {{ return Get<FName>(Offsets::UObjectName); }}
+	inline TRemotePtr<class {}> Outer() const {{ return Get<TRemotePtr<class {}>>(Offsets::UObjectOuter); }}
+
+	/* Name of the object, decoded from the cached FNamePool blocks */
+	inline std::string GetName() const {{ return GetContext() ? GetContext()->GetName(Name()) : std::string(); }}
+)", ClassName, ClassName, StructName, StructName);
+	}
+
+	std::string AccessorString;
+
+	for (const IRMember& Member : IR.GetMembers(Struct))
+	{
+		std::string Name = Member.UniqueName;
+
+		if (ReservedNames.contains(Name) || Name == StructName)
+			Name += "_";
+
+		if (Member.bIsBitField)
+		{
+			AccessorString += std::format("\tinline bool {}() const {{ return GetBit(0x{:04X}, 0x{:02X}); }}\n", Name, Member.Offset, Member.FieldMask);
+			continue;
+		}
+
+		const bool bHasUnresolvedReference = HasUnresolvedReference(IR, Member.TypeIndex);
+
+		if (bHasUnresolvedReference)
+			std::cerr << std::format("RemoteSDKGenerator: The struct or enum referenced by '{}::{}' isn't part of the IR!\n", Struct.RawName, Member.RawName);
+
+		const std::string Type = GetAccessorType(IR, Member.TypeIndex, Member.Size);
+
+		if (Type.empty())
+		{
+			AccessorString += std::format("\t// 0x{:04X}(0x{:04X}) {}, {}\n", Member.Offset, Member.Size, Member.RawName, bHasUnresolvedReference ? "referenced type not found" : "property-type not supported");
+			continue;
+		}
+
+		if (Member.ArrayDim > 0x1)
+		{
+			AccessorString += std::format("\tinline {0} {1}(int32 Index) const {{ return Get<{0}>(0x{2:04X} + (Index * TRemoteElement<{0}>::Size)); }} // [0x{3:X}]\n", Type, Name, Member.Offset, Member.ArrayDim);
+			continue;
+		}
+
+		AccessorString += std::format("\tinline {0} {1}() const {{ return Get<{0}>(0x{2:04X}); }}\n", Type, Name, Member.Offset);
+	}
+
+	if (!AccessorString.empty())
+		SdkFile << "\npublic:\n" << AccessorString;
+
+	SdkFile << "};\n";
+}
+
+void RemoteSDKGenerator::GenerateBasicFile(OutputBuffer& BasicFile)
+{
+	const bool bHasNamePool = Settings::Internal::bUseNamePool && Off::InSDK::NameArray::GNames != 0x0;
+
+	BasicFile << R"(#pragma once
+
+/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+
+/*
+* Runtime of the remote SDK. Views read the target's memory through an 'IMemoryReader' implemented by the user, for example with
+* ReadProcessMemory, a driver or a memory dump. 'FBufferReader' maps a byte-buffer to an address, 'RemoteBasicTest.cpp' uses it to test
+* this runtime against synthetic objects.
+*
+* FRemoteContext Context(Reader, ImageBase);
+* UObject Object(&Context, ObjectAddress);   // one read of UObject::StructSize bytes
+* std::string Name = Object.GetName();      // name-entries are read in blocks and cached
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <type_traits>
+
+namespace RemoteSDK
+{
+
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+)";
+
+	BasicFile.Format(R"(
+/* Engine layout at the time the SDK was generated */
+namespace Offsets
+{{
+	constexpr bool bHasNamePool = {};
+
+	constexpr uint64 GNames = 0x{:08X}; // Offset of FNamePool from the image-base
+	constexpr int32 NamePoolBlocks = 0x{:04X};
+	constexpr int32 NameBlockOffsetBits = 0x{:04X};
+	constexpr int32 NameEntryStride = 0x{:04X};
+	constexpr int32 NameEntryHeader = 0x{:04X};
+	constexpr int32 NameEntryString = 0x{:04X};
+	constexpr int32 NameLengthBitOffset = 0x{:04X};
+	constexpr int32 NameLengthBitCount = 0x{:04X};
+
+	constexpr int32 FNameSize = 0x{:04X};
+	constexpr int32 FNameComparisonIndex = 0x{:04X};
+	constexpr int32 FNameNumber = 0x{:04X};
+	constexpr bool bHasInlineNameNumber = {}; // The number of outline-number names is stored in FNamePool, it is always 0 here
+
+	constexpr int32 UObjectFlags = 0x{:04X};
+	constexpr int32 UObjectIndex = 0x{:04X};
+	constexpr int32 UObjectClass = 0x{:04X};
+	constexpr int32 UObjectName = 0x{:04X};
+	constexpr int32 UObjectOuter = 0x{:04X};
+}}
+)", bHasNamePool
+  , static_cast<uint32>(Off::InSDK::NameArray::GNames)
+  , bHasNamePool ? Off::NameArray::ChunksStart : 0x0
+  , Off::InSDK::NameArray::FNamePoolBlockOffsetBits
+  , Off::InSDK::NameArray::FNameEntryStride
+  , bHasNamePool ? Off::FNameEntry::NamePool::HeaderOffset : 0x0
+  , bHasNamePool ? Off::FNameEntry::NamePool::StringOffset : 0x0
+  , Settings::Internal::bUseCasePreservingName ? 1 : 6
+  , Settings::Internal::bUseCasePreservingName ? 15 : 10
+  , Off::InSDK::Name::FNameSize
+  , Off::FName::CompIdx
+  , Off::FName::Number
+  , !Settings::Internal::bUseOutlineNumberName
+  , Off::UObject::Flags
+  , Off::UObject::Index
+  , Off::UObject::Class
+  , Off::UObject::Name
+  , Off::UObject::Outer);
+
+	BasicFile << R"(
+/* Upper bounds for reads of TArray/FString, counts above these are treated as garbage */
+constexpr int32 MaxRemoteElements = 0x1000000;
+constexpr int64 MaxRemoteReadSize = 0x10000000;
+
+class IMemoryReader
+{
+public:
+	virtual ~IMemoryReader() = default;
+
+public:
+	/* Reads 'Size' bytes at 'Address' into 'Buffer'. Returns false if not all bytes could be read. */
+	virtual bool Read(uint64 Address, void* Buffer, uint64 Size) = 0;
+};
+
+/* Reader for a byte-buffer mapped to 'BaseAddress' */
+class FBufferReader : public IMemoryReader
+{
+private:
+	uint64 BaseAddress;
+	std::vector<uint8> Bytes;
+
+public:
+	FBufferReader(uint64 BaseAddress, std::vector<uint8> Bytes)
+		: BaseAddress(BaseAddress), Bytes(std::move(Bytes))
+	{
+	}
+
+public:
+	bool Read(uint64 Address, void* Buffer, uint64 Size) override
+	{
+		if (Address < BaseAddress || Size > Bytes.size() || (Address - BaseAddress) > (Bytes.size() - Size))
+			return false;
+
+		memcpy(Buffer, Bytes.data() + (Address - BaseAddress), Size);
+		return true;
+	}
+
+public:
+	inline uint64 GetBaseAddress() const { return BaseAddress; }
+	inline std::vector<uint8>& GetBytes() { return Bytes; }
+};
+
+inline std::string Utf16ToUtf8(const char16_t* Str, size_t Length)
+{
+	std::string Result;
+	Result.reserve(Length);
+
+	for (size_t i = 0; i < Length; i++)
+	{
+		uint32 Char = Str[i];
+
+		if (Char >= 0xD800 && Char <= 0xDBFF && (i + 1) < Length && Str[i + 1] >= 0xDC00 && Str[i + 1] <= 0xDFFF)
+			Char = 0x10000 + ((Char - 0xD800) << 10) + (Str[++i] - 0xDC00);
+
+		if (Char < 0x80)
+		{
+			Result.push_back(static_cast<char>(Char));
+		}
+		else if (Char < 0x800)
+		{
+			Result.push_back(static_cast<char>(0xC0 | (Char >> 6)));
+			Result.push_back(static_cast<char>(0x80 | (Char & 0x3F)));
+		}
+		else if (Char < 0x10000)
+		{
+			Result.push_back(static_cast<char>(0xE0 | (Char >> 12)));
+			Result.push_back(static_cast<char>(0x80 | ((Char >> 6) & 0x3F)));
+			Result.push_back(static_cast<char>(0x80 | (Char & 0x3F)));
+		}
+		else
+		{
+			Result.push_back(static_cast<char>(0xF0 | (Char >> 18)));
+			Result.push_back(static_cast<char>(0x80 | ((Char >> 12) & 0x3F)));
+			Result.push_back(static_cast<char>(0x80 | ((Char >> 6) & 0x3F)));
+			Result.push_back(static_cast<char>(0x80 | (Char & 0x3F)));
+		}
+	}
+
+	return Result;
+}
+
+struct FName
+{
+	int32 ComparisonIndex;
+	uint32 Number;
+
+	bool operator==(const FName& Other) const = default;
+};
+
+/*
+* Reads through an IMemoryReader. Blocks of the FNamePool are read whole on first use, decoded names are cached by their comparison-index.
+* Not thread-safe, use one context per thread.
+*/
+class FRemoteContext
+{
+private:
+	IMemoryReader& Reader;
+	uint64 ImageBase;
+
+	std::unordered_map<uint32, std::vector<uint8>> NameBlocks;
+	std::unordered_map<int32, std::string> NameStrings;
+
+public:
+	FRemoteContext(IMemoryReader& Reader, uint64 ImageBase)
+		: Reader(Reader), ImageBase(ImageBase)
+	{
+	}
+
+private:
+	const std::vector<uint8>* GetNameBlock(uint32 BlockIndex, bool bReload)
+	{
+		if (!bReload)
+		{
+			if (auto It = NameBlocks.find(BlockIndex); It != NameBlocks.end())
+				return &It->second;
+		}
+
+		const uint64 BlockAddress = Read<uint64>(ImageBase + Offsets::GNames + Offsets::NamePoolBlocks + (BlockIndex * sizeof(uint64)));
+
+		std::vector<uint8> Block(static_cast<size_t>(Offsets::NameEntryStride) << Offsets::NameBlockOffsetBits);
+
+		if (!Read(BlockAddress, Block.data(), Block.size()))
+		{
+			NameBlocks.erase(BlockIndex);
+			return nullptr;
+		}
+
+		return &(NameBlocks[BlockIndex] = std::move(Block));
+	}
+
+	static bool DecodeNameEntry(const std::vector<uint8>& Block, size_t EntryOffset, std::string& OutName)
+	{
+		if ((EntryOffset + Offsets::NameEntryString) > Block.size())
+			return false;
+
+		uint16 Header = 0x0;
+		memcpy(&Header, Block.data() + EntryOffset + Offsets::NameEntryHeader, sizeof(uint16));
+
+		const bool bIsWide = Header & 0x1;
+		const size_t Length = (Header >> Offsets::NameLengthBitOffset) & ((1 << Offsets::NameLengthBitCount) - 1);
+
+		const size_t StringOffset = EntryOffset + Offsets::NameEntryString;
+		const size_t ByteLength = Length * (bIsWide ? sizeof(char16_t) : sizeof(char));
+
+		/* Entries with a length of 0 weren't written yet when the block was read */
+		if (Length == 0 || (StringOffset + ByteLength) > Block.size())
+			return false;
+
+		if (!bIsWide)
+		{
+			OutName.assign(reinterpret_cast<const char*>(Block.data() + StringOffset), Length);
+			return true;
+		}
+
+		std::u16string WideName(Length, u'\0');
+		memcpy(WideName.data(), Block.data() + StringOffset, ByteLength);
+
+		OutName = Utf16ToUtf8(WideName.data(), WideName.size());
+		return true;
+	}
+
+public:
+	inline IMemoryReader& GetReader() const { return Reader; }
+	inline uint64 GetImageBase() const { return ImageBase; }
+
+	inline bool Read(uint64 Address, void* Buffer, uint64 Size)
+	{
+		return Address != 0x0 && Reader.Read(Address, Buffer, Size);
+	}
+
+	template<typename T>
+	inline T Read(uint64 Address)
+	{
+		T Value{};
+
+		if (!Read(Address, &Value, sizeof(T)))
+			return T{};
+
+		return Value;
+	}
+
+	/* String of the name-entry, without the number. Empty if the entry couldn't be read. */
+	const std::string& GetNameEntryString(int32 ComparisonIndex)
+	{
+		static const std::string EmptyString;
+
+		if (!Offsets::bHasNamePool)
+			return EmptyString;
+
+		if (auto It = NameStrings.find(ComparisonIndex); It != NameStrings.end())
+			return It->second;
+
+		const uint32 BlockIndex = static_cast<uint32>(ComparisonIndex) >> Offsets::NameBlockOffsetBits;
+		const size_t EntryOffset = static_cast<size_t>(ComparisonIndex & ((1 << Offsets::NameBlockOffsetBits) - 1)) * Offsets::NameEntryStride;
+
+		std::string Name;
+
+		/* Names are appended at runtime, the block is read again once if the entry is newer than the cached copy */
+		for (const bool bReload : { false, true })
+		{
+			const std::vector<uint8>* Block = GetNameBlock(BlockIndex, bReload);
+
+			if (Block && DecodeNameEntry(*Block, EntryOffset, Name))
+				return NameStrings[ComparisonIndex] = std::move(Name);
+		}
+
+		return EmptyString;
+	}
+
+	std::string GetName(FName Name)
+	{
+		std::string Result = GetNameEntryString(Name.ComparisonIndex);
+
+		if (Name.Number > 0)
+			Result += "_" + std::to_string(Name.Number - 1);
+
+		return Result;
+	}
+};
+
+/*
+* View of a struct in the target. Its memory is read once, when the view is created, accessors only copy from this snapshot.
+* Views of members and of array-elements share the snapshot they were created from.
+*/
+class FRemoteStruct
+{
+private:
+	FRemoteContext* Context = nullptr;
+	uint64 Address = 0x0;
+
+	std::shared_ptr<const std::vector<uint8>> Data;
+	int32 DataOffset = 0x0;
+
+public:
+	FRemoteStruct() = default;
+
+	FRemoteStruct(FRemoteContext* Context, uint64 Address, int32 Size)
+		: Context(Context), Address(Address)
+	{
+		if (!Context || Address == 0x0 || Size <= 0)
+			return;
+
+		auto Bytes = std::make_shared<std::vector<uint8>>(Size);
+
+		if (Context->Read(Address, Bytes->data(), Size))
+			Data = std::move(Bytes);
+	}
+
+	FRemoteStruct(const FRemoteStruct& Outer, int32 Offset)
+		: Context(Outer.Context), Address(Outer.Address + Offset), Data(Outer.Data), DataOffset(Outer.DataOffset + Offset)
+	{
+	}
+
+public:
+	inline FRemoteContext* GetContext() const { return Context; }
+	inline uint64 GetAddress() const { return Address; }
+
+	/* False if the memory of this struct couldn't be read */
+	inline bool IsValid() const { return Data != nullptr; }
+
+	/* Copies 'Size' bytes at 'Offset' out of the snapshot. 'Buffer' is zeroed if they are out of bounds. */
+	inline bool ReadBytes(int32 Offset, void* Buffer, int32 Size) const
+	{
+		if (!Data || Offset < 0 || (static_cast<size_t>(DataOffset) + Offset + Size) > Data->size())
+		{
+			memset(Buffer, 0, Size);
+			return false;
+		}
+
+		memcpy(Buffer, Data->data() + DataOffset + Offset, Size);
+		return true;
+	}
+
+	inline bool GetBit(int32 Offset, uint8 FieldMask) const
+	{
+		uint8 Byte = 0x0;
+		ReadBytes(Offset, &Byte, sizeof(uint8));
+
+		return (Byte & FieldMask) != 0;
+	}
+
+	template<typename ElementType>
+	inline ElementType Get(int32 Offset) const;
+};
+
+template<typename ViewType>
+class TRemotePtr
+{
+private:
+	FRemoteContext* Context = nullptr;
+	uint64 Address = 0x0;
+
+public:
+	TRemotePtr() = default;
+
+	TRemotePtr(FRemoteContext* Context, uint64 Address)
+		: Context(Context), Address(Address)
+	{
+	}
+
+public:
+	inline uint64 GetAddress() const { return Address; }
+	inline bool IsNull() const { return Address == 0x0; }
+
+	/* Reads the pointed-to object with a single read of 'ViewType::StructSize' bytes */
+	inline ViewType Read() const { return ViewType(Context, Address); }
+
+	/* The type is not checked, use for objects known to be of a derived class */
+	template<typename OtherViewType>
+	inline TRemotePtr<OtherViewType> Cast() const { return TRemotePtr<OtherViewType>(Context, Address); }
+
+public:
+	explicit operator bool() const { return Address != 0x0; }
+
+	bool operator==(const TRemotePtr& Other) const { return Address == Other.Address; }
+};
+
+template<typename ElementType>
+class TRemoteArray
+{
+private:
+	FRemoteContext* Context = nullptr;
+	uint64 Data = 0x0;
+	int32 NumElements = 0x0;
+
+public:
+	TRemoteArray() = default;
+
+	TRemoteArray(FRemoteContext* Context, uint64 Data, int32 NumElements)
+		: Context(Context), Data(Data), NumElements(NumElements)
+	{
+	}
+
+public:
+	inline int32 Num() const { return NumElements; }
+	inline uint64 GetDataAddress() const { return Data; }
+
+	inline bool IsValid() const { return Context && Data != 0x0 && NumElements > 0 && NumElements <= MaxRemoteElements; }
+
+	/* Reads all elements with a single read */
+	std::vector<ElementType> Read() const;
+
+	/* Reads a single element */
+	ElementType Read(int32 Index) const;
+};
+
+class FRemoteString
+{
+private:
+	FRemoteContext* Context = nullptr;
+	uint64 Data = 0x0;
+	int32 NumElements = 0x0;
+
+public:
+	FRemoteString() = default;
+
+	FRemoteString(FRemoteContext* Context, uint64 Data, int32 NumElements)
+		: Context(Context), Data(Data), NumElements(NumElements)
+	{
+	}
+
+public:
+	/* Number of characters, including the null-terminator */
+	inline int32 Num() const { return NumElements; }
+
+	std::string ToString() const
+	{
+		if (!Context || Data == 0x0 || NumElements <= 1 || NumElements > MaxRemoteElements)
+			return "";
+
+		std::u16string Chars(NumElements - 1, u'\0');
+
+		if (!Context->Read(Data, Chars.data(), Chars.size() * sizeof(char16_t)))
+			return "";
+
+		return Utf16ToUtf8(Chars.data(), Chars.size());
+	}
+};
+
+/* Size of a type in the target's memory, and how it's copied out of a snapshot */
+template<typename ElementType>
+struct TRemoteElement
+{
+	static_assert(std::is_trivially_copyable_v<ElementType>, "Type can't be read from a snapshot!");
+
+	static constexpr int32 Size = sizeof(ElementType);
+
+	static ElementType Get(const FRemoteStruct& Struct, int32 Offset)
+	{
+		ElementType Value;
+		Struct.ReadBytes(Offset, &Value, Size);
+
+		return Value;
+	}
+};
+
+template<typename ViewType> requires(std::is_base_of_v<FRemoteStruct, ViewType>)
+struct TRemoteElement<ViewType>
+{
+	static constexpr int32 Size = ViewType::StructSize;
+
+	static ViewType Get(const FRemoteStruct& Struct, int32 Offset) { return ViewType(Struct, Offset); }
+};
+
+template<>
+struct TRemoteElement<bool>
+{
+	static constexpr int32 Size = sizeof(uint8);
+
+	static bool Get(const FRemoteStruct& Struct, int32 Offset) { return Struct.GetBit(Offset, 0xFF); }
+};
+
+template<>
+struct TRemoteElement<FName>
+{
+	static constexpr int32 Size = Offsets::FNameSize;
+
+	static FName Get(const FRemoteStruct& Struct, int32 Offset)
+	{
+		FName Name = { 0x0, 0x0 };
+		Struct.ReadBytes(Offset + Offsets::FNameComparisonIndex, &Name.ComparisonIndex, sizeof(int32));
+
+		if constexpr (Offsets::bHasInlineNameNumber)
+			Struct.ReadBytes(Offset + Offsets::FNameNumber, &Name.Number, sizeof(uint32));
+
+		return Name;
+	}
+};
+
+template<>
+struct TRemoteElement<FRemoteString>
+{
+	static constexpr int32 Size = 0x10;
+
+	static FRemoteString Get(const FRemoteStruct& Struct, int32 Offset)
+	{
+		uint64 Data = 0x0;
+		int32 NumElements = 0x0;
+
+		Struct.ReadBytes(Offset + 0x0, &Data, sizeof(uint64));
+		Struct.ReadBytes(Offset + 0x8, &NumElements, sizeof(int32));
+
+		return FRemoteString(Struct.GetContext(), Data, NumElements);
+	}
+};
+
+template<typename ViewType>
+struct TRemoteElement<TRemotePtr<ViewType>>
+{
+	static constexpr int32 Size = sizeof(uint64);
+
+	static TRemotePtr<ViewType> Get(const FRemoteStruct& Struct, int32 Offset)
+	{
+		uint64 Address = 0x0;
+		Struct.ReadBytes(Offset, &Address, sizeof(uint64));
+
+		return TRemotePtr<ViewType>(Struct.GetContext(), Address);
+	}
+};
+
+template<typename InnerType>
+struct TRemoteElement<TRemoteArray<InnerType>>
+{
+	static constexpr int32 Size = 0x10;
+
+	static TRemoteArray<InnerType> Get(const FRemoteStruct& Struct, int32 Offset)
+	{
+		uint64 Data = 0x0;
+		int32 NumElements = 0x0;
+
+		Struct.ReadBytes(Offset + 0x0, &Data, sizeof(uint64));
+		Struct.ReadBytes(Offset + 0x8, &NumElements, sizeof(int32));
+
+		return TRemoteArray<InnerType>(Struct.GetContext(), Data, NumElements);
+	}
+};
+
+template<typename ElementType>
+inline ElementType FRemoteStruct::Get(int32 Offset) const
+{
+	return TRemoteElement<ElementType>::Get(*this, Offset);
+}
+
+template<typename ElementType>
+inline std::vector<ElementType> TRemoteArray<ElementType>::Read() const
+{
+	constexpr int32 ElementSize = TRemoteElement<ElementType>::Size;
+
+	std::vector<ElementType> Elements;
+
+	if (!IsValid() || (static_cast<int64>(NumElements) * ElementSize) > MaxRemoteReadSize)
+		return Elements;
+
+	const FRemoteStruct Snapshot(Context, Data, NumElements * ElementSize);
+
+	if (!Snapshot.IsValid())
+		return Elements;
+
+	Elements.reserve(NumElements);
+
+	for (int32 i = 0; i < NumElements; i++)
+		Elements.push_back(Snapshot.Get<ElementType>(i * ElementSize));
+
+	return Elements;
+}
+
+template<typename ElementType>
+inline ElementType TRemoteArray<ElementType>::Read(int32 Index) const
+{
+	constexpr int32 ElementSize = TRemoteElement<ElementType>::Size;
+
+	if (!IsValid() || Index < 0 || Index >= NumElements)
+		return FRemoteStruct().Get<ElementType>(0x0);
+
+	return FRemoteStruct(Context, Data + (static_cast<uint64>(Index) * ElementSize), ElementSize).Get<ElementType>(0x0);
+}
+
+}
+)";
+}
+
+void RemoteSDKGenerator::GenerateTestFile(OutputBuffer& TestFile)
+{
+	TestFile << R"(/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+
+/*
+* Tests of 'RemoteBasic.hpp' against synthetic objects in an FBufferReader. Doesn't require the game, builds on any platform:
+*
+* g++ -std=c++20 RemoteBasicTest.cpp -o RemoteBasicTest && ./RemoteBasicTest
+*/
+
+#include <iostream>
+
+#include "RemoteBasic.hpp"
+
+using namespace RemoteSDK;
+
+/* Layout of the synthetic objects, the offsets of FName are taken from 'Offsets' */
+class FTestView : public FRemoteStruct
+{
+public:
+	static constexpr int32 StructSize = 0x50;
+
+public:
+	using FRemoteStruct::FRemoteStruct;
+
+	FTestView() = default;
+
+	FTestView(FRemoteContext* Context, uint64 Address)
+		: FRemoteStruct(Context, Address, StructSize)
+	{
+	}
+
+public:
+	inline int32 Value() const { return Get<int32>(0x0000); }
+	inline bool Flag() const { return GetBit(0x0004, 0x02); }
+	inline FName Name() const { return Get<FName>(0x0008); }
+	inline TRemoteArray<int32> Values() const { return Get<TRemoteArray<int32>>(0x0020); }
+	inline FRemoteString Label() const { return Get<FRemoteString>(0x0030); }
+	inline TRemotePtr<FTestView> Next() const { return Get<TRemotePtr<FTestView>>(0x0040); }
+};
+
+static_assert(Offsets::FNameSize <= 0x18, "FName overlaps the next member of FTestView!");
+
+constexpr uint64 BufferAddress = 0x10000;
+constexpr uint64 ObjectAddress = 0x11000;
+constexpr uint64 NextObjectAddress = 0x11100;
+constexpr uint64 ValuesAddress = 0x12000;
+constexpr uint64 LabelAddress = 0x13000;
+constexpr uint64 NameBlockAddress = 0x20000;
+
+/* Chosen so the pointer to the first block of FNamePool is the first qword of the buffer */
+constexpr uint64 ImageBase = BufferAddress - Offsets::GNames - Offsets::NamePoolBlocks;
+
+constexpr size_t NameBlockSize = static_cast<size_t>(Offsets::NameEntryStride) << Offsets::NameBlockOffsetBits;
+
+template<typename T>
+void Write(FBufferReader& Reader, uint64 Address, const T& Value)
+{
+	memcpy(Reader.GetBytes().data() + (Address - Reader.GetBaseAddress()), &Value, sizeof(T));
+}
+
+void WriteNameEntry(FBufferReader& Reader, int32 ComparisonIndex, const std::string& Name)
+{
+	const uint64 EntryAddress = NameBlockAddress + (static_cast<uint64>(ComparisonIndex) * Offsets::NameEntryStride);
+
+	Write(Reader, EntryAddress + Offsets::NameEntryHeader, static_cast<uint16>(Name.size() << Offsets::NameLengthBitOffset));
+	memcpy(Reader.GetBytes().data() + (EntryAddress + Offsets::NameEntryString - BufferAddress), Name.data(), Name.size());
+}
+
+int main()
+{
+	FBufferReader Reader(BufferAddress, std::vector<uint8>((NameBlockAddress - BufferAddress) + NameBlockSize, 0x0));
+
+	Write(Reader, BufferAddress, NameBlockAddress);
+
+	Write(Reader, ObjectAddress + 0x00, static_cast<int32>(0x1234));
+	Write(Reader, ObjectAddress + 0x04, static_cast<uint8>(0x02));
+	Write(Reader, ObjectAddress + 0x08 + Offsets::FNameComparisonIndex, static_cast<int32>(0x1));
+	Write(Reader, ObjectAddress + 0x20, ValuesAddress);
+	Write(Reader, ObjectAddress + 0x28, static_cast<int32>(0x3));
+	Write(Reader, ObjectAddress + 0x30, LabelAddress);
+	Write(Reader, ObjectAddress + 0x38, static_cast<int32>(0x3));
+	Write(Reader, ObjectAddress + 0x40, NextObjectAddress);
+
+	Write(Reader, NextObjectAddress + 0x00, static_cast<int32>(0x5678));
+
+	for (int32 i = 0; i < 0x3; i++)
+		Write(Reader, ValuesAddress + (i * sizeof(int32)), static_cast<int32>(i * 0x10));
+
+	Write(Reader, LabelAddress + 0x0, u'H');
+	Write(Reader, LabelAddress + 0x2, u'i');
+
+	if constexpr (Offsets::bHasNamePool)
+		WriteNameEntry(Reader, 0x1, "Object");
+
+	FRemoteContext Context(Reader, ImageBase);
+
+	int32 NumFailedChecks = 0;
+
+	auto Check = [&NumFailedChecks](bool bCondition, const char* Description) -> void
+	{
+		if (bCondition)
+			return;
+
+		std::cerr << "RemoteBasicTest: " << Description << "\n";
+		NumFailedChecks++;
+	};
+
+	uint8 Byte = 0x0;
+	Check(!Reader.Read(BufferAddress - 0x1, &Byte, 0x1), "Expected reads before the buffer to fail");
+	Check(!Reader.Read(BufferAddress + Reader.GetBytes().size() - 0x1, &Byte, 0x2), "Expected reads past the end of the buffer to fail");
+	Check(!Reader.Read(BufferAddress, &Byte, ~0ull), "Expected reads larger than the buffer to fail");
+
+	const FTestView Object(&Context, ObjectAddress);
+
+	Check(Object.IsValid(), "Expected the object to be read");
+	Check(Object.Value() == 0x1234, "Expected 'Value' to be 0x1234");
+	Check(Object.Flag(), "Expected 'Flag' to be set");
+
+	/* Members are copied from the snapshot taken when the view was created */
+	Write(Reader, ObjectAddress + 0x00, static_cast<int32>(0x0));
+	Check(Object.Value() == 0x1234, "Expected 'Value' to be read from the snapshot");
+	Check(FTestView(&Context, ObjectAddress).Value() == 0x0, "Expected a new view to read the object again");
+
+	const std::vector<int32> Values = Object.Values().Read();
+	Check(Values == std::vector<int32>{ 0x0, 0x10, 0x20 }, "Expected 'Values' to be { 0x0, 0x10, 0x20 }");
+	Check(Object.Values().Read(0x2) == 0x20 && Object.Values().Read(0x3) == 0x0, "Expected single elements of 'Values' to be read in bounds only");
+
+	Check(Object.Label().ToString() == "Hi", "Expected 'Label' to be \"Hi\"");
+	Check(Object.Next().Read().Value() == 0x5678, "Expected 'Next->Value' to be 0x5678");
+
+	if constexpr (Offsets::bHasNamePool)
+	{
+		Check(Context.GetName(Object.Name()) == "Object", "Expected 'Name' to be \"Object\"");
+		Check(Context.GetName(FName{ 0x1, 0x3 }) == "Object_2", "Expected the number to be appended to the name");
+
+		/* Entries appended after the block was cached are found by reading the block again. The index is past the entry of "Object". */
+		WriteNameEntry(Reader, 0x100, "Late");
+		Check(Context.GetName(FName{ 0x100, 0x0 }) == "Late", "Expected a name added after the block was cached");
+	}
+
+	const FTestView InvalidObject(&Context, 0x8);
+	Check(!InvalidObject.IsValid() && InvalidObject.Value() == 0x0 && InvalidObject.Values().Read().empty(), "Expected an unreadable object to be invalid and zeroed");
+
+	std::cerr << "RemoteBasicTest: " << (NumFailedChecks == 0 ? "succeeded" : "failed") << "\n";
+
+	return NumFailedChecks == 0 ? 0 : 1;
+}
+)";
+}
+
+void RemoteSDKGenerator::Generate()
+{
+	const SDKIR& IR = IRManager::GetIR();
+
+	EnumPackageIndices.assign(IR.Enums.size(), -1);
+
+	for (int32 i = 0; i < static_cast<int32>(IR.Packages.size()); i++)
+	{
+		for (const int32 EnumIndex : IR.Packages[i].Enums)
+			EnumPackageIndices[EnumIndex] = i;
+	}
+
+	OutputBuffer BasicFile;
+	GenerateBasicFile(BasicFile);
+
+	if (!BasicFile.WriteToFile(MainFolder / "RemoteBasic.hpp"))
+		std::cerr << "RemoteSDKGenerator: Failed to write 'RemoteBasic.hpp'!\n";
+
+	OutputBuffer TestFile;
+	GenerateTestFile(TestFile);
+
+	if (!TestFile.WriteToFile(MainFolder / "RemoteBasicTest.cpp"))
+		std::cerr << "RemoteSDKGenerator: Failed to write 'RemoteBasicTest.cpp'!\n";
+
+	OutputBuffer SdkFile;
+
+	SdkFile << R"(#pragma once
+
+/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+
+#include "RemoteBasic.hpp"
+
+namespace RemoteSDK
+{
+)";
+
+	const std::vector<int32> SortedStructs = GetSortedStructs(IR);
+
+	for (const int32 StructIndex : SortedStructs)
+		SdkFile.Format("class {};\n", GetStructName(IR, IR.Structs[StructIndex]));
+
+	for (const IREnum& Enum : IR.Enums)
+		GenerateEnum(SdkFile, IR, Enum);
+
+	for (const int32 StructIndex : SortedStructs)
+		GenerateStruct(SdkFile, IR, IR.Structs[StructIndex]);
+
+	SdkFile << "\n}\n";
+
+	if (!SdkFile.WriteToFile(MainFolder / "RemoteSDK.hpp"))
+		std::cerr << "RemoteSDKGenerator: Failed to write 'RemoteSDK.hpp'!\n";
+
+	std::cerr << std::format("RemoteSDKGenerator: Generated {} views and {} enums.\n", SortedStructs.size(), IR.Enums.size());
+}
@@ -70,46 +70,16 @@ ParamNameCollisionCount: {};
 )", StringifyCollisionType(static_cast<ECollisionType>(OwnType)), MemberNameCollisionCount, SuperMemberNameCollisionCount, FunctionNameCollisionCount, SuperFuncNameCollisionCount, ParamNameCollisionCount);
 }
 
-uint64 KeyFunctions::GetKeyForCollisionInfo(UEStruct Super, UEProperty Member)
+void CollisionManager::AddNameToContainer(NameContainer& StructNames, NameContainer* FuncParamNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct)
 {
-	uint64 Key = 0x0;
-
-	FName Name = Member.GetFName();
-	Key += Name.GetCompIdx();
-	Key += Name.GetNumber();
-
-	Key <<= 32;
-	Key |= (static_cast<uint64>(Member.GetOffset()) << 24);
-	Key |= (static_cast<uint64>(Member.GetSize()) << 16);
-	Key |= Super.GetIndex();
-
-	return reinterpret_cast<uint64>(Member.GetAddress());
-}
-
-uint64 KeyFunctions::GetKeyForCollisionInfo([[maybe_unused]] UEStruct Super, UEFunction Member)
-{
-	uint64 Key = 0x0;
-
-	FName Name = Member.GetFName();
-	Key += Name.GetCompIdx();
-	Key += Name.GetNumber();
-
-	Key <<= 32;
-	Key |= Member.GetIndex();
-
-	return Key;
-}
-
-uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func)
-{
-	static auto AddCollidingName = [](const NameContainer& SearchNames, NameContainer* OutTargetNames, HashStringTableIndex NameIdx, ECollisionType CurrentType, bool bIsSuper) -> bool
+	static auto AddCollidingName = [](std::span<const NameInfo> SearchNames, NameContainer* OutTargetNames, HashStringTableIndex NameIdx, ECollisionType CurrentType, bool bIsSuper) -> bool
 	{
 		assert(OutTargetNames && "Target container was nullptr!");
 
 		NameInfo NewInfo(NameIdx, CurrentType);
 		NewInfo.OwnType = static_cast<uint8>(CurrentType);
 
-		for (auto RevIt = SearchNames.crbegin(); RevIt != SearchNames.crend(); ++RevIt)
+		for (auto RevIt = SearchNames.rbegin(); RevIt != SearchNames.rend(); ++RevIt)
 		{
 			const NameInfo& ExistingName = *RevIt;
 
@@ -133,30 +103,26 @@ uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, UEStruct
 	{
 		// Create new empty NameInfo
 		StructNames.emplace_back(NameIdx, CurrentType);
-		return StructNames.size() - 1;
+		return;
 	}
 
-	NameContainer* FuncParamNames = nullptr;
-
-	if (Func)
+	if (FuncParamNames)
 	{
-		FuncParamNames = &NameInfos[Func.GetIndex()];
-
 		if (bWasInserted && bIsParameter)
 		{
 			// Create new empty NameInfo
 			FuncParamNames->emplace_back(NameIdx, CurrentType);
-			return FuncParamNames->size() - 1;
+			return;
 		}
 
 		if (AddCollidingName(*FuncParamNames, FuncParamNames, NameIdx, CurrentType, false))
-			return FuncParamNames->size() - 1;
+			return;
 
 		if (bIsStruct)
 		{
 			/* Serach ReservedNames last, just in case there was a property which also collided with a reserved name already */
 			if (AddCollidingName(ReservedNames, FuncParamNames, NameIdx, CurrentType, false))
-				return FuncParamNames->size() - 1;
+				return;
 		}
 	}
 
@@ -164,41 +130,51 @@ uint64 CollisionManager::AddNameToContainer(NameContainer& StructNames, UEStruct
 
 	/* Check all member-names from this struct and see if we're colliding with one of them */
 	if (AddCollidingName(StructNames, TargetNameContainer, NameIdx, CurrentType, false))
-		return TargetNameContainer->size() - 1;
+		return;
 
 	/* This possibly duplicated name doesn't occcure in the NameList of the struct itself, so check all supers to see if we're colliding with a super's name. */
 	for (UEStruct Current = Struct.GetSuper(); Current; Current = Current.GetSuper())
 	{
-		NameContainer& SuperNames = NameInfos[Current.GetIndex()];
+		if (!HasNameSlice(Current.GetIndex()))
+			continue;
 
-		if (AddCollidingName(SuperNames, TargetNameContainer, NameIdx, CurrentType, true))
-			return TargetNameContainer->size() - 1;
+		if (AddCollidingName(GetNameCollisionInfos(Current), TargetNameContainer, NameIdx, CurrentType, true))
+			return;
 	}
 
 	if (!bIsStruct)
 	{
 		/* Serach ReservedNames last, just in case there was a predefined member of the super-class, or local variable, that collids with it. */
 		if (AddCollidingName(ClassReservedNames, TargetNameContainer, NameIdx, CurrentType, false))
-			return TargetNameContainer->size() - 1;
+			return;
 	}
 
 	/* Serach ReservedNames last, just in case there was a property in the struct or parent struct, which also collided with a reserved name already */
 	if (AddCollidingName(ReservedNames, TargetNameContainer, NameIdx, CurrentType, false))
-		return TargetNameContainer->size() - 1;
+		return;
 
 	/* Searching this structs' name list, the super's name list, as well as ReservedNames did not yield any results. No collision on this name, add it! */
 	if (bIsParameter && FuncParamNames)
 	{
 		FuncParamNames->emplace_back(NameIdx, CurrentType);
-		return FuncParamNames->size() - 1;
 	}
 	else
 	{
 		StructNames.emplace_back(NameIdx, CurrentType);
-		return StructNames.size() - 1;
 	}
 }
 
+void CollisionManager::AddNameSlice(int32 ObjectIndex, const NameContainer& Names)
+{
+	if (ObjectIndex >= SliceIndices.size())
+		SliceIndices.resize(ObjectIndex + 1, -1);
+
+	SliceIndices[ObjectIndex] = static_cast<int32>(NameSlices.size());
+	NameSlices.push_back({ static_cast<int32>(NameInfos.size()), static_cast<int32>(Names.size()) });
+
+	NameInfos.insert(NameInfos.end(), Names.begin(), Names.end());
+}
+
 void CollisionManager::AddReservedClassName(const std::string& Name, bool bIsParameterOrLocalVariable)
 {
 	NameInfo NewInfo;
@@ -223,36 +199,35 @@ void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
 {
 	if (UEStruct Super = Struct.GetSuper())
 	{
-		if (NameInfos.find(Super.GetIndex()) == NameInfos.end())
+		if (!HasNameSlice(Super.GetIndex()))
 			AddStructToNameContainer(Super, bIsStruct);
 	}
 
-	NameContainer& StructNames = NameInfos[Struct.GetIndex()];
-
-	if (!StructNames.empty())
+	if (HasNameSlice(Struct.GetIndex()))
 		return;
 
-	auto AddToContainerAndTranslationMap = [&](auto Member, ECollisionType CollisionType, bool bIsStruct, UEFunction Func = nullptr) -> void
-	{
-		const uint64 Index = AddNameToContainer(StructNames, Struct, MemberNames.FindOrAdd(Member.GetValidName()), CollisionType, bIsStruct, Func);
-
-		const auto [It, bInserted] = TranslationMap.emplace(KeyFunctions::GetKeyForCollisionInfo(Struct, Member), Index);
-		
-		if (!bInserted)
-			std::cerr << "Error, no insertion took place, key {0x" << std::hex << KeyFunctions::GetKeyForCollisionInfo(Struct, Member) << "} duplicated!" << std::endl;
-	};
+	/* Names are collected per struct/function first and then copied into NameInfos, so every slice is contiguous */
+	NameContainer StructNames;
+	std::vector<std::pair<int32, NameContainer>> FuncParamNames;
 
 	for (UEProperty Prop : Struct.GetProperties())
-		AddToContainerAndTranslationMap(Prop, ECollisionType::MemberName, bIsStruct);
+		AddNameToContainer(StructNames, nullptr, Struct, MemberNames.FindOrAdd(Prop.GetValidName()), ECollisionType::MemberName, bIsStruct);
 
 	for (UEFunction Func : Struct.GetFunctions())
 	{
-		AddToContainerAndTranslationMap(Func, ECollisionType::FunctionName, bIsStruct);
+		AddNameToContainer(StructNames, nullptr, Struct, MemberNames.FindOrAdd(Func.GetValidName()), ECollisionType::FunctionName, bIsStruct);
+
+		NameContainer& ParamNames = FuncParamNames.emplace_back(Func.GetIndex(), NameContainer{}).second;
 
 		for (UEProperty Prop : Func.GetProperties())
-			AddToContainerAndTranslationMap(Prop, ECollisionType::ParameterName, bIsStruct, Func);
+			AddNameToContainer(StructNames, &ParamNames, Struct, MemberNames.FindOrAdd(Prop.GetValidName()), ECollisionType::ParameterName, bIsStruct);
 	}
-};
+
+	AddNameSlice(Struct.GetIndex(), StructNames);
+
+	for (const auto& [FuncIndex, ParamNames] : FuncParamNames)
+		AddNameSlice(FuncIndex, ParamNames);
+}
 
 std::string CollisionManager::StringifyName(UEStruct Struct, NameInfo Info)
 {
@@ -0,0 +1,60 @@
+#include "Unreal/ObjectArray.h"
+
+#include "Managers/DenseIndexManager.h"
+
+void DenseIndexManager::AddObject(int32 ObjectIndex, EDenseIndexType Type)
+{
+	IndexListType& IndicesOfType = ObjectIndices[static_cast<size_t>(Type)];
+
+	DenseIndices[ObjectIndex] = static_cast<int32>(IndicesOfType.size());
+	IndexTypes[ObjectIndex] = Type;
+
+	IndicesOfType.push_back(ObjectIndex);
+}
+
+void DenseIndexManager::Init()
+{
+	if (bIsInitialized)
+		return;
+
+	bIsInitialized = true;
+
+	const int32 NumObjects = ObjectArray::Num();
+
+	DenseIndices.assign(NumObjects, -1);
+	IndexTypes.assign(NumObjects, EDenseIndexType::None);
+
+	for (auto Obj : ObjectArray())
+	{
+		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+			continue;
+
+		const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
+
+		if (bIsFunction)
+		{
+			AddObject(Obj.GetIndex(), EDenseIndexType::Function);
+		}
+		else if (Obj.IsA(EClassCastFlags::Struct))
+		{
+			AddObject(Obj.GetIndex(), EDenseIndexType::Struct);
+		}
+		else if (Obj.IsA(EClassCastFlags::Enum))
+		{
+			AddObject(Obj.GetIndex(), EDenseIndexType::Enum);
+		}
+		else
+		{
+			continue;
+		}
+
+		/* Only packages containing structs, classes or enums are tracked, functions are always in the package of their class */
+		if (bIsFunction)
+			continue;
+
+		const int32 PackageIndex = Obj.GetPackageIndex();
+
+		if (GetType(PackageIndex) == EDenseIndexType::None)
+			AddObject(PackageIndex, EDenseIndexType::Package);
+	}
+}
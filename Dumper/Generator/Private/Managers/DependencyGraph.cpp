@@ -0,0 +1,146 @@
+#include "Managers/DependencyGraph.h"
+
+DependencyGraph::DependencyGraph(int32 InNumNodes)
+	: NumNodes(InNumNodes)
+{
+}
+
+void DependencyGraph::AddEdge(int32 From, int32 To)
+{
+	if (bIsFinalized) [[unlikely]]
+		return;
+
+	PendingEdges.emplace_back(From, To);
+}
+
+void DependencyGraph::InitEdges()
+{
+	EdgeOffsets.assign(NumNodes + 1, 0x0);
+	Edges.resize(PendingEdges.size());
+
+	/* Counting sort by source node, stable so every node keeps the insertion order of its edges */
+	for (const auto& [From, To] : PendingEdges)
+		EdgeOffsets[From + 1]++;
+
+	for (int32 i = 0; i < NumNodes; i++)
+		EdgeOffsets[i + 1] += EdgeOffsets[i];
+
+	std::vector<int32> InsertPositions(EdgeOffsets.begin(), EdgeOffsets.end() - 1);
+
+	for (const auto& [From, To] : PendingEdges)
+		Edges[InsertPositions[From]++] = To;
+
+	PendingEdges.clear();
+	PendingEdges.shrink_to_fit();
+}
+
+/* Iterative implementation of Tarjan's SCC algorithm, to not overflow the stack on deep dependency-chains */
+void DependencyGraph::InitComponents()
+{
+	constexpr int32 Unvisited = -1;
+
+	std::vector<int32> DiscoveryIndices(NumNodes, Unvisited);
+	std::vector<int32> LowLinks(NumNodes, 0x0);
+	std::vector<bool> IsOnStack(NumNodes, false);
+
+	/* Pair<Node, NextEdgeOffset> */
+	std::vector<std::pair<int32, int32>> CallStack;
+	std::vector<int32> ComponentStack;
+
+	ComponentIndices.assign(NumNodes, Unvisited);
+
+	int32 NextDiscoveryIndex = 0x0;
+
+	auto VisitNode = [&](int32 Node) -> void
+	{
+		DiscoveryIndices[Node] = NextDiscoveryIndex;
+		LowLinks[Node] = NextDiscoveryIndex;
+		NextDiscoveryIndex++;
+
+		ComponentStack.push_back(Node);
+		IsOnStack[Node] = true;
+
+		CallStack.emplace_back(Node, EdgeOffsets[Node]);
+	};
+
+	for (int32 Root = 0; Root < NumNodes; Root++)
+	{
+		if (DiscoveryIndices[Root] != Unvisited)
+			continue;
+
+		VisitNode(Root);
+
+		while (!CallStack.empty())
+		{
+			const int32 Node = CallStack.back().first;
+			int32& NextEdgeOffset = CallStack.back().second;
+
+			if (NextEdgeOffset < EdgeOffsets[Node + 1])
+			{
+				const int32 Target = Edges[NextEdgeOffset++];
+
+				if (DiscoveryIndices[Target] == Unvisited)
+				{
+					VisitNode(Target);
+				}
+				else if (IsOnStack[Target] && DiscoveryIndices[Target] < LowLinks[Node])
+				{
+					LowLinks[Node] = DiscoveryIndices[Target];
+				}
+
+				continue;
+			}
+
+			CallStack.pop_back();
+
+			if (!CallStack.empty())
+			{
+				const int32 Parent = CallStack.back().first;
+
+				if (LowLinks[Node] < LowLinks[Parent])
+					LowLinks[Parent] = LowLinks[Node];
+			}
+
+			/* Node is not the root of its component */
+			if (LowLinks[Node] != DiscoveryIndices[Node])
+				continue;
+
+			const int32 ComponentIndex = static_cast<int32>(CyclicComponents.size());
+
+			int32 ComponentSize = 0x0;
+			int32 Member = Unvisited;
+
+			do
+			{
+				Member = ComponentStack.back();
+				ComponentStack.pop_back();
+
+				IsOnStack[Member] = false;
+				ComponentIndices[Member] = ComponentIndex;
+				ComponentSize++;
+
+			} while (Member != Node);
+
+			bool bIsCyclic = ComponentSize > 1;
+
+			for (int32 i = EdgeOffsets[Node]; !bIsCyclic && i < EdgeOffsets[Node + 1]; i++)
+				bIsCyclic = Edges[i] == Node;
+
+			CyclicComponents.push_back(bIsCyclic);
+
+			if (bIsCyclic)
+				NumCyclicComponents++;
+		}
+	}
+}
+
+void DependencyGraph::Finalize()
+{
+	if (bIsFinalized)
+		return;
+
+	bIsFinalized = true;
+
+	InitEdges();
+	InitComponents();
+}
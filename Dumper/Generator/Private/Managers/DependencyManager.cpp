@@ -2,7 +2,7 @@
 
 DependencyManager::DependencyManager(int32 ObjectToTrack)
 {
-	AllDependencies.try_emplace(ObjectToTrack, IndexDependencyInfo{ });
+	AllDependencies.try_emplace(ObjectToTrack);
 }
 
 void DependencyManager::SetExists(const int32 DepedantIdx)
@@ -12,49 +12,113 @@ void DependencyManager::SetExists(const int32 DepedantIdx)
 
 void DependencyManager::AddDependency(const int32 DepedantIdx, int32 DependencyIndex)
 {
-	AllDependencies[DepedantIdx].DependencyIndices.insert(DependencyIndex);
+	AllDependencies[DepedantIdx].insert(DependencyIndex);
 }
 
 void DependencyManager::SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies)
 {
-	AllDependencies[DepedantIdx].DependencyIndices = std::move(Dependencies);
+	AllDependencies[DepedantIdx] = std::move(Dependencies);
 }
 
-size_t DependencyManager::GetNumEntries() const
+void DependencyManager::Finalize()
 {
-	return AllDependencies.size();
+	if (bIsFinalized)
+		return;
+
+	bIsFinalized = true;
+
+	/* Keep the iteration order of the maps, it decides the order in which structs are generated */
+	Nodes.reserve(AllDependencies.size());
+	NodeIndices.reserve(AllDependencies.size());
+
+	for (const auto& [Index, Dependencies] : AllDependencies)
+	{
+		NodeIndices.emplace(Index, static_cast<int32>(Nodes.size()));
+		Nodes.push_back(Index);
+	}
+
+	Graph = DependencyGraph(static_cast<int32>(Nodes.size()));
+
+	for (const auto& [Index, Dependencies] : AllDependencies)
+	{
+		const int32 Node = NodeIndices.at(Index);
+
+		for (int32 Dependency : Dependencies)
+		{
+			auto It = NodeIndices.find(Dependency);
+
+			/* Every dependency must've been added as a node itself, a missing one means the graph was built incorrectly */
+			if (It == NodeIndices.end())
+			{
+				std::cerr << std::format("DependencyManager: Dependency 0x{:X} of 0x{:X} was never added, the edge is ignored!\n", Dependency, Index);
+				assert(false && "Dependency isn't a node of the graph!");
+				continue;
+			}
+
+			Graph.AddEdge(Node, It->second);
+		}
+	}
+
+	Graph.Finalize();
+
+	AllDependencies.clear();
 }
 
-void DependencyManager::VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const
+size_t DependencyManager::GetNumEntries() const
 {
-	auto& [IterationHitCounter, Dependencies] = AllDependencies.at(Index);
+	return bIsFinalized ? Nodes.size() : AllDependencies.size();
+}
 
-	if (IterationHitCounter >= CurrentIterationHitCount)
+void DependencyManager::VisitNodeAndDependencies(int32 Node, std::vector<bool>& VisitedNodes, std::vector<std::pair<int32, int32>>& Stack, const OnVisitCallbackType& Callback) const
+{
+	if (VisitedNodes[Node])
 		return;
 
-	IterationHitCounter = CurrentIterationHitCount;
+	VisitedNodes[Node] = true;
+	Stack.emplace_back(Node, 0x0);
 
-	for (int32 Dependency : Dependencies)
+	/* Post-order traversal, dependencies are visited before the nodes requiring them */
+	while (!Stack.empty())
 	{
-		VisitIndexAndDependencies(Dependency, Callback);
-	}
+		const int32 CurrentNode = Stack.back().first;
+		int32& NextDependency = Stack.back().second;
 
-	Callback(Index);
+		const std::span<const int32> Dependencies = Graph.GetEdges(CurrentNode);
+
+		if (NextDependency < Dependencies.size())
+		{
+			const int32 Dependency = Dependencies[NextDependency++];
+
+			if (!VisitedNodes[Dependency])
+			{
+				VisitedNodes[Dependency] = true;
+				Stack.emplace_back(Dependency, 0x0);
+			}
+
+			continue;
+		}
+
+		Stack.pop_back();
+
+		Callback(Nodes[CurrentNode]);
+	}
 }
 
 void DependencyManager::VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const
 {
-	CurrentIterationHitCount++;
+	std::vector<bool> VisitedNodes(Nodes.size(), false);
+	std::vector<std::pair<int32, int32>> Stack;
 
-	VisitIndexAndDependencies(Index, Callback);
+	VisitNodeAndDependencies(NodeIndices.at(Index), VisitedNodes, Stack, Callback);
 }
 
 void DependencyManager::VisitAllNodesWithCallback(OnVisitCallbackType Callback) const
 {
-	CurrentIterationHitCount++;
+	std::vector<bool> VisitedNodes(Nodes.size(), false);
+	std::vector<std::pair<int32, int32>> Stack;
 
-	for (const auto& [Index, DependencyInfo] : AllDependencies)
+	for (int32 Node = 0; Node < Nodes.size(); Node++)
 	{
-		VisitIndexAndDependencies(Index, Callback);
+		VisitNodeAndDependencies(Node, VisitedNodes, Stack, Callback);
 	}
 }
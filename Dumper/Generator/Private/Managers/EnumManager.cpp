@@ -1,3 +1,7 @@
+#include <execution>
+#include <numeric>
+#include <atomic>
+
 #include "Managers/EnumManager.h"
 
 namespace EnumInitHelper
@@ -67,135 +71,182 @@ const StringEntry& EnumInfoHandle::GetName() const
 
 int32 EnumInfoHandle::GetNumMembers() const
 {
-	return Info->MemberInfos.size();
+	return Info->NumMembers;
 }
 
 CollisionInfoIterator EnumInfoHandle::GetMemberCollisionInfoIterator() const
 {
-	return CollisionInfoIterator(Info->MemberInfos);
+	return CollisionInfoIterator(EnumManager::GetMembers(*Info));
 }
 
-void EnumManager::InitInternal()
+void EnumManager::InitUnderlyingSizesFromProperties()
 {
-	for (auto Obj : ObjectArray())
+	/*
+	* Find the underlaying size of enums from properties referencing them. The last property found for an enum, in the order of GObjects, decides its size.
+	* 
+	* Structs are visited in parallel, so every enum keeps the position of the last property found so far, packed as [ObjectIndex|PropertyIndex|Size] to be
+	* compared and updated atomically. Zero means no property was found.
+	*/
+	std::vector<std::atomic<uint64>> LastInstances(EnumInfos.size());
+
+	auto FindEnumProperties = [&LastInstances](int32 ObjectIndex) -> void
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-			continue;
+		const UEStruct ObjAsStruct = ObjectArray::GetByIndex<UEStruct>(ObjectIndex);
+
+		uint32 PropertyIndex = 0x0;
 
-		if (Obj.IsA(EClassCastFlags::Struct))
+		for (UEProperty Property : ObjAsStruct.GetProperties())
 		{
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+			PropertyIndex++;
 
-			for (UEProperty Property : ObjAsStruct.GetProperties())
+			UEEnum Enum = nullptr;
+
+			if (Property.IsA(EClassCastFlags::EnumProperty))
 			{
-				if (!Property.IsA(EClassCastFlags::EnumProperty) && !Property.IsA(EClassCastFlags::ByteProperty))
+				if (!Property.Cast<UEEnumProperty>().GetUnderlayingProperty())
 					continue;
 
-				UEEnum Enum = nullptr;
-				UEProperty UnderlayingProperty = nullptr;
+				Enum = Property.Cast<UEEnumProperty>().GetEnum();
+			}
+			else if (Property.IsA(EClassCastFlags::ByteProperty))
+			{
+				Enum = Property.Cast<UEByteProperty>().GetEnum();
+			}
 
-				if (Property.IsA(EClassCastFlags::EnumProperty))
-				{
-					Enum = Property.Cast<UEEnumProperty>().GetEnum();
-					UnderlayingProperty = Property.Cast<UEEnumProperty>().GetUnderlayingProperty();
+			if (!Enum)
+				continue;
 
-					if (!UnderlayingProperty)
-						continue;
-				}
-				else /* ByteProperty */
-				{
-					Enum = Property.Cast<UEByteProperty>().GetEnum();
-					UnderlayingProperty = Property;
-				}
+			const uint64 Instance = (static_cast<uint64>(ObjectIndex) << 32) | (static_cast<uint64>(PropertyIndex & 0xFFFFFF) << 8) | static_cast<uint8>(Property.GetSize());
 
-				if (!Enum)
-					continue;
+			std::atomic<uint64>& LastInstance = LastInstances.at(DenseIndexManager::GetDenseIndex(Enum.GetIndex(), EDenseIndexType::Enum));
+			uint64 Expected = LastInstance.load(std::memory_order_relaxed);
 
-				EnumInfo& Info = EnumInfoOverrides[Enum.GetIndex()];
+			while (Expected < Instance && !LastInstance.compare_exchange_weak(Expected, Instance, std::memory_order_relaxed))
+				continue;
+		}
+	};
 
-				Info.bWasInstanceFound = true;
-				Info.UnderlyingTypeSize = 0x1;
+	const DenseIndexManager::IndexListType& Structs = DenseIndexManager::GetObjectIndices(EDenseIndexType::Struct);
+	const DenseIndexManager::IndexListType& Functions = DenseIndexManager::GetObjectIndices(EDenseIndexType::Function);
 
-				/* Check if the size of this enums underlaying type is greater than the default size (0x1) */
-				if (Enum)
-				{
-					Info.UnderlyingTypeSize = Property.GetSize();
-					continue;
-				}
+	std::for_each(std::execution::par, Structs.begin(), Structs.end(), FindEnumProperties);
+	std::for_each(std::execution::par, Functions.begin(), Functions.end(), FindEnumProperties);
 
-				if (UnderlayingProperty)
-				{
-					Info.UnderlyingTypeSize = UnderlayingProperty.GetSize();
-					continue;
-				}
-			}
-		}
-		else if (Obj.IsA(EClassCastFlags::Enum))
+	for (int32 DenseIndex = 0; DenseIndex < EnumInfos.size(); DenseIndex++)
+	{
+		const uint64 LastInstance = LastInstances[DenseIndex].load(std::memory_order_relaxed);
+
+		if (LastInstance == 0x0)
+			continue;
+
+		EnumInfos[DenseIndex].bWasInstanceFound = true;
+		EnumInfos[DenseIndex].UnderlyingTypeSize = static_cast<uint8>(LastInstance & 0xFF);
+	}
+}
+
+void EnumManager::InitInternal()
+{
+	/* Names and values of an enum, decoded from UEnum::Names */
+	struct DecodedEnum
+	{
+		std::string Name;
+		std::vector<std::pair<std::string, uint64>> Members;
+
+		/* Highest value, not counting the '_MAX' member */
+		uint64 MaxValue = 0x0;
+	};
+
+	std::vector<DecodedEnum> DecodedEnums(EnumInfos.size());
+
+	std::vector<int32> DenseIndices(EnumInfos.size());
+	std::iota(DenseIndices.begin(), DenseIndices.end(), 0x0);
+
+	/* Reading and converting names is independent for every enum, only adding them to the name-tables below has to be ordered */
+	std::for_each(std::execution::par, DenseIndices.begin(), DenseIndices.end(), [&DecodedEnums](int32 DenseIndex) -> void
+	{
+		const UEEnum ObjAsEnum = ObjectArray::GetByIndex<UEEnum>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Enum));
+
+		DecodedEnum& Decoded = DecodedEnums[DenseIndex];
+		Decoded.Name = ObjAsEnum.GetEnumPrefixedName();
+
+		std::vector<std::pair<FName, int64>> NameValuePairs = ObjAsEnum.GetNameValuePairs();
+		Decoded.Members.reserve(NameValuePairs.size());
+
+		for (auto& [Name, Value] : NameValuePairs)
 		{
-			UEEnum ObjAsEnum = Obj.Cast<UEEnum>();
+			std::wstring NameWitPrefix = Name.ToWString();
 
-			/* Add name to override info */
-			EnumInfo& NewOrExistingInfo = EnumInfoOverrides[Obj.GetIndex()];
-			NewOrExistingInfo.Name = UniqueEnumNameTable.FindOrAdd(ObjAsEnum.GetEnumPrefixedName()).first;
+			if (!NameWitPrefix.ends_with(L"_MAX"))
+				Decoded.MaxValue = max(Decoded.MaxValue, Value);
 
-			uint64 EnumMaxValue = 0x0;
+			Decoded.Members.emplace_back(MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1)), Value);
+		}
+	});
 
-			/* Initialize enum-member names and their collision infos */
-			std::vector<std::pair<FName, int64>> NameValuePairs = ObjAsEnum.GetNameValuePairs();
-			for (int i = 0; i < NameValuePairs.size(); i++)
-			{
-				auto& [Name, Value] = NameValuePairs[i];
-					
-				std::wstring NameWitPrefix = Name.ToWString();
+	size_t NumMembersTotal = 0x0;
 
-				if (!NameWitPrefix.ends_with(L"_MAX"))
-					EnumMaxValue = max(EnumMaxValue, Value);
+	for (const DecodedEnum& Decoded : DecodedEnums)
+		NumMembersTotal += Decoded.Members.size();
 
-				auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAdd(MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1)));
+	EnumMembers.reserve(NumMembersTotal);
 
-				EnumCollisionInfo CurrentEnumValueInfo;
-				CurrentEnumValueInfo.MemberName = NameIndex;
-				CurrentEnumValueInfo.MemberValue = Value;
+	/* Enums are visited in the order of GObjects, the order decides which of two colliding names is considered unique */
+	for (int32 DenseIndex = 0; DenseIndex < EnumInfos.size(); DenseIndex++)
+	{
+		DecodedEnum& Decoded = DecodedEnums[DenseIndex];
 
-				if (bWasInserted) [[likely]]
-				{
-					NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
-					continue;
-				}
+		/* Add name to override info */
+		EnumInfo& NewOrExistingInfo = EnumInfos[DenseIndex];
+		NewOrExistingInfo.Name = UniqueEnumNameTable.FindOrAdd(Decoded.Name).first;
+		NewOrExistingInfo.MembersOffset = static_cast<int32>(EnumMembers.size());
+		NewOrExistingInfo.NumMembers = static_cast<int32>(Decoded.Members.size());
 
-				/* A value with this name exists globally, now check if it also exists localy (aka. is duplicated) */
-				for (int j = 0; j < i; j++)
-				{
-					EnumCollisionInfo& CrosscheckedInfo = NewOrExistingInfo.MemberInfos[j];
+		/* Initialize enum-member names and their collision infos */
+		for (int i = 0; i < Decoded.Members.size(); i++)
+		{
+			auto& [Name, Value] = Decoded.Members[i];
 
-					if (CrosscheckedInfo.MemberName != NameIndex) [[likely]]
-						continue;
+			auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAdd(std::move(Name));
 
-					/* Duplicate was found */
-					CurrentEnumValueInfo.CollisionCount = CrosscheckedInfo.CollisionCount + 1;
-					break;
-				}
+			EnumCollisionInfo CurrentEnumValueInfo;
+			CurrentEnumValueInfo.MemberName = NameIndex;
+			CurrentEnumValueInfo.MemberValue = Value;
 
-				/* Check if this name is illegal */
-				for (HashStringTableIndex IllegalIndex : IllegalNames)
-				{
-					if (NameIndex == IllegalIndex) [[unlikely]]
-					{
-						CurrentEnumValueInfo.CollisionCount++;
-						break;
-					}
-				}
+			if (bWasInserted) [[likely]]
+			{
+				EnumMembers.push_back(CurrentEnumValueInfo);
+				continue;
+			}
+
+			/* A value with this name exists globally, now check if it also exists localy (aka. is duplicated) */
+			for (int j = 0; j < i; j++)
+			{
+				EnumCollisionInfo& CrosscheckedInfo = EnumMembers[NewOrExistingInfo.MembersOffset + j];
 
-				NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
+				if (CrosscheckedInfo.MemberName != NameIndex) [[likely]]
+					continue;
+
+				/* Duplicate was found */
+				CurrentEnumValueInfo.CollisionCount = CrosscheckedInfo.CollisionCount + 1;
+				break;
 			}
 
-			/* Initialize the size based on the highest value contained by this enum */
-			if (!NewOrExistingInfo.bWasEnumSizeInitialized && !NewOrExistingInfo.bWasInstanceFound)
+			/* Check if this name is illegal */
+			for (HashStringTableIndex IllegalIndex : IllegalNames)
 			{
-				EnumInitHelper::SetEnumSizeForValue(NewOrExistingInfo.UnderlyingTypeSize, EnumMaxValue);
-				NewOrExistingInfo.bWasEnumSizeInitialized = true;
+				if (NameIndex == IllegalIndex) [[unlikely]]
+				{
+					CurrentEnumValueInfo.CollisionCount++;
+					break;
+				}
 			}
+
+			EnumMembers.push_back(CurrentEnumValueInfo);
 		}
+
+		/* Initialize the size based on the highest value contained by this enum */
+		if (!NewOrExistingInfo.bWasInstanceFound)
+			EnumInitHelper::SetEnumSizeForValue(NewOrExistingInfo.UnderlyingTypeSize, Decoded.MaxValue);
 	}
 }
 
@@ -231,8 +282,9 @@ void EnumManager::Init()
 
 	bIsInitialized = true;
 
-	EnumInfoOverrides.reserve(0x1000);
+	EnumInfos.resize(DenseIndexManager::GetNum(EDenseIndexType::Enum));
 
 	InitIllegalNames(); // call this first
+	InitUnderlyingSizesFromProperties();
 	InitInternal();
 }
@@ -0,0 +1,707 @@
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+#include <format>
+
+#include "Unreal/ObjectArray.h"
+
+#include "Managers/IRManager.h"
+#include "Managers/DenseIndexManager.h"
+#include "Managers/PackageManager.h"
+#include "Managers/MemberManager.h"
+#include "Wrappers/StructWrapper.h"
+#include "Wrappers/MemberWrappers.h"
+#include "Wrappers/EnumWrapper.h"
+
+#include "Platform.h"
+#include "Utils.h"
+
+#include "../Settings.h"
+
+
+int32 IRManager::AddPropertyType(UEProperty Property)
+{
+	if (!Property)
+		return -1;
+
+	IRPropertyType Type;
+
+	auto [Class, FieldClass] = Property.GetClass();
+
+	Type.CastFlags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+
+	if (Type.CastFlags & EClassCastFlags::ByteProperty)
+	{
+		if (const UEEnum Enum = Property.Cast<UEByteProperty>().GetEnum())
+			Type.ReferencedEnumIndex = DenseIndexManager::GetDenseIndex(Enum.GetIndex(), EDenseIndexType::Enum);
+	}
+	else if (Type.CastFlags & EClassCastFlags::EnumProperty)
+	{
+		const UEEnumProperty AsEnumProperty = Property.Cast<UEEnumProperty>();
+
+		if (const UEEnum Enum = AsEnumProperty.GetEnum())
+			Type.ReferencedEnumIndex = DenseIndexManager::GetDenseIndex(Enum.GetIndex(), EDenseIndexType::Enum);
+
+		Type.InnerTypes[0] = AddPropertyType(AsEnumProperty.GetUnderlayingProperty());
+	}
+	else if (Type.CastFlags & EClassCastFlags::StructProperty)
+	{
+		if (const UEStruct Struct = Property.Cast<UEStructProperty>().GetUnderlayingStruct())
+			Type.ReferencedStructIndex = DenseIndexManager::GetDenseIndex(Struct.GetIndex(), EDenseIndexType::Struct);
+	}
+	else if (Type.CastFlags & EClassCastFlags::ArrayProperty)
+	{
+		Type.InnerTypes[0] = AddPropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty());
+	}
+	else if (Type.CastFlags & EClassCastFlags::SetProperty)
+	{
+		Type.InnerTypes[0] = AddPropertyType(Property.Cast<UESetProperty>().GetElementProperty());
+	}
+	else if (Type.CastFlags & EClassCastFlags::OptionalProperty)
+	{
+		Type.InnerTypes[0] = AddPropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty());
+	}
+	else if (Type.CastFlags & EClassCastFlags::MapProperty)
+	{
+		const UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
+
+		Type.InnerTypes[0] = AddPropertyType(AsMapProperty.GetKeyProperty());
+		Type.InnerTypes[1] = AddPropertyType(AsMapProperty.GetValueProperty());
+	}
+
+	IR.PropertyTypes.push_back(std::move(Type));
+
+	return static_cast<int32>(IR.PropertyTypes.size() - 1);
+}
+
+int32 IRManager::AddMembers(const MemberManager& Members)
+{
+	int32 NumAddedMembers = 0x0;
+
+	for (const PropertyWrapper& Member : Members.IterateMembers())
+	{
+		if (!Member.IsUnrealProperty())
+			continue;
+
+		IRMember NewMember;
+		NewMember.RawName = Member.GetUnrealProperty().GetName();
+		NewMember.UniqueName = Member.GetName();
+		NewMember.Offset = Member.GetOffset();
+		NewMember.Size = Member.GetSize();
+		NewMember.ArrayDim = Member.GetArrayDim();
+		NewMember.PropertyFlags = Member.GetPropertyFlags();
+		NewMember.bIsBitField = Member.IsBitField();
+
+		if (NewMember.bIsBitField)
+		{
+			NewMember.BitIndex = Member.GetBitIndex();
+			NewMember.FieldMask = Member.GetFieldMask();
+		}
+
+		NewMember.TypeIndex = AddPropertyType(Member.GetUnrealProperty());
+
+		IR.Members.push_back(std::move(NewMember));
+		NumAddedMembers++;
+	}
+
+	return NumAddedMembers;
+}
+
+void IRManager::InitFunction(int32 DenseIndex)
+{
+	const UEFunction Func = ObjectArray::GetByIndex<UEFunction>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Function));
+
+	const StructWrapper AsStruct(Func);
+
+	IRFunction& Info = IR.Functions[DenseIndex];
+	Info.RawName = Func.GetName();
+	Info.Name = Func.GetValidName();
+	Info.UniqueName = Info.Name; /* Replaced by the collision-free name, if the function belongs to a class */
+	Info.FunctionFlags = Func.GetFunctionFlags();
+	Info.ParamStructSize = Func.GetStructSize();
+
+	if (Func.HasFlags(EFunctionFlags::Native))
+		Info.ExecFunctionOffset = static_cast<uint32>(Platform::GetOffset(Func.GetExecFunction()));
+
+	Info.ParamsOffset = static_cast<int32>(IR.Members.size());
+	Info.NumParams = AddMembers(AsStruct.GetMembers());
+}
+
+void IRManager::InitStruct(int32 DenseIndex)
+{
+	const UEStruct Struct = ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Struct));
+
+	const StructWrapper Wrapper(Struct);
+
+	IRStruct& Info = IR.Structs[DenseIndex];
+	Info.RawName = Struct.GetName();
+	Info.CppName = Struct.GetCppName();
+
+	auto [UniqueName, bIsUnique] = Wrapper.GetUniqueName();
+	Info.UniqueName = std::move(UniqueName);
+	Info.bIsUniqueName = bIsUnique;
+
+	Info.PackageIndex = DenseIndexManager::GetDenseIndex(Struct.GetPackageIndex(), EDenseIndexType::Package);
+
+	if (const UEStruct Super = Struct.GetSuper())
+		Info.SuperIndex = DenseIndexManager::GetDenseIndex(Super.GetIndex(), EDenseIndexType::Struct);
+
+	Info.Size = Wrapper.GetSize();
+	Info.Alignment = Wrapper.GetAlignment();
+	Info.bIsClass = Wrapper.IsClass();
+	Info.bIsFinal = Wrapper.IsFinal();
+
+	/* Only classes that don't share the VTable with their super-class get an own VTable */
+	if (Info.bIsClass)
+	{
+		const UEClass Class = Struct.Cast<UEClass>();
+
+		if (const UEObject DefaultObject = Class.GetDefaultObject())
+		{
+			const UEClass Super = Class.GetSuper().Cast<UEClass>();
+			const UEObject SuperDefaultObject = Super ? Super.GetDefaultObject() : nullptr;
+
+			if (!SuperDefaultObject || DefaultObject.GetVft() != SuperDefaultObject.GetVft())
+				Info.VftOffset = static_cast<uint32>(Platform::GetOffset(DefaultObject.GetVft()));
+		}
+	}
+
+	const MemberManager Members = Wrapper.GetMembers();
+
+	Info.MembersOffset = static_cast<int32>(IR.Members.size());
+	Info.NumMembers = AddMembers(Members);
+
+	Info.FunctionsOffset = static_cast<int32>(IR.FunctionIndices.size());
+
+	for (const FunctionWrapper& Func : Members.IterateFunctions())
+	{
+		if (Func.IsPredefined())
+			continue;
+
+		const int32 FunctionIndex = DenseIndexManager::GetDenseIndex(Func.GetUnrealFunction().GetIndex(), EDenseIndexType::Function);
+
+		IRFunction& FunctionInfo = IR.Functions[FunctionIndex];
+		FunctionInfo.UniqueName = Func.GetName();
+		FunctionInfo.OuterIndex = DenseIndex;
+
+		IR.FunctionIndices.push_back(FunctionIndex);
+		Info.NumFunctions++;
+	}
+}
+
+void IRManager::InitEnum(int32 DenseIndex)
+{
+	const EnumWrapper Enum(ObjectArray::GetByIndex<UEEnum>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Enum)));
+
+	IREnum& Info = IR.Enums[DenseIndex];
+	Info.RawName = Enum.GetRawName();
+
+	auto [UniqueName, bIsUnique] = Enum.GetUniqueName();
+	Info.UniqueName = std::move(UniqueName);
+	Info.bIsUniqueName = bIsUnique;
+
+	Info.UnderlyingTypeSize = Enum.GetUnderlyingTypeSize();
+
+	Info.MembersOffset = static_cast<int32>(IR.EnumMembers.size());
+
+	for (const EnumCollisionInfo& Member : Enum.GetMembers())
+		IR.EnumMembers.push_back({ Member.GetUniqueName(), Member.GetValue() });
+
+	Info.NumMembers = static_cast<int32>(IR.EnumMembers.size()) - Info.MembersOffset;
+}
+
+void IRManager::InitPackage(int32 DenseIndex)
+{
+	const PackageInfoHandle Package = PackageManager::GetInfo(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Package));
+
+	IRPackage& Info = IR.Packages[DenseIndex];
+	Info.Name = Package.GetName();
+	Info.bIsEmpty = Package.IsEmpty();
+
+	for (const int32 EnumIndex : Package.GetEnums())
+		Info.Enums.push_back(DenseIndexManager::GetDenseIndex(EnumIndex, EDenseIndexType::Enum));
+
+	if (Package.HasStructs())
+	{
+		Package.GetSortedStructs().VisitAllNodesWithCallback([&Info](int32 Index) -> void
+		{
+			Info.SortedStructs.push_back(DenseIndexManager::GetDenseIndex(Index, EDenseIndexType::Struct));
+		});
+	}
+
+	if (Package.HasClasses())
+	{
+		Package.GetSortedClasses().VisitAllNodesWithCallback([&Info](int32 Index) -> void
+		{
+			Info.SortedClasses.push_back(DenseIndexManager::GetDenseIndex(Index, EDenseIndexType::Struct));
+		});
+	}
+}
+
+void IRManager::Init()
+{
+	if (bIsInitialized)
+		return;
+
+	bIsInitialized = true;
+
+	IR.Packages.resize(DenseIndexManager::GetNum(EDenseIndexType::Package));
+	IR.Structs.resize(DenseIndexManager::GetNum(EDenseIndexType::Struct));
+	IR.Functions.resize(DenseIndexManager::GetNum(EDenseIndexType::Function));
+	IR.Enums.resize(DenseIndexManager::GetNum(EDenseIndexType::Enum));
+
+	/* Functions first, InitStruct() assigns the collision-free names to functions of classes */
+	for (int32 i = 0; i < IR.Functions.size(); i++)
+		InitFunction(i);
+
+	for (int32 i = 0; i < IR.Structs.size(); i++)
+		InitStruct(i);
+
+	for (int32 i = 0; i < IR.Enums.size(); i++)
+		InitEnum(i);
+
+	for (int32 i = 0; i < IR.Packages.size(); i++)
+		InitPackage(i);
+}
+
+bool IRManager::SaveToFile(const std::filesystem::path& FilePath)
+{
+	std::string StringPool;
+	std::vector<int32> PackageIndices;
+
+	auto AddString = [&StringPool](const std::string& Str) -> IRFile::StringRef
+	{
+		const IRFile::StringRef Ref = { static_cast<uint32>(StringPool.size()), static_cast<uint32>(Str.size()) };
+		StringPool += Str;
+
+		return Ref;
+	};
+
+	auto AddIndices = [&PackageIndices](const std::vector<int32>& Indices) -> int32
+	{
+		const int32 Offset = static_cast<int32>(PackageIndices.size());
+		PackageIndices.insert(PackageIndices.end(), Indices.begin(), Indices.end());
+
+		return Offset;
+	};
+
+	std::vector<IRFile::Package> Packages;
+	Packages.reserve(IR.Packages.size());
+
+	for (const IRPackage& Package : IR.Packages)
+	{
+		IRFile::Package& Record = Packages.emplace_back();
+		Record.Name = AddString(Package.Name);
+		Record.EnumsOffset = AddIndices(Package.Enums);
+		Record.NumEnums = static_cast<int32>(Package.Enums.size());
+		Record.StructsOffset = AddIndices(Package.SortedStructs);
+		Record.NumStructs = static_cast<int32>(Package.SortedStructs.size());
+		Record.ClassesOffset = AddIndices(Package.SortedClasses);
+		Record.NumClasses = static_cast<int32>(Package.SortedClasses.size());
+		Record.bIsEmpty = Package.bIsEmpty;
+	}
+
+	std::vector<IRFile::Struct> Structs;
+	Structs.reserve(IR.Structs.size());
+
+	for (const IRStruct& Struct : IR.Structs)
+	{
+		IRFile::Struct& Record = Structs.emplace_back();
+		Record.RawName = AddString(Struct.RawName);
+		Record.CppName = AddString(Struct.CppName);
+		Record.UniqueName = AddString(Struct.UniqueName);
+		Record.PackageIndex = Struct.PackageIndex;
+		Record.SuperIndex = Struct.SuperIndex;
+		Record.Size = Struct.Size;
+		Record.Alignment = Struct.Alignment;
+		Record.VftOffset = Struct.VftOffset;
+		Record.MembersOffset = Struct.MembersOffset;
+		Record.NumMembers = Struct.NumMembers;
+		Record.FunctionsOffset = Struct.FunctionsOffset;
+		Record.NumFunctions = Struct.NumFunctions;
+		Record.bIsUniqueName = Struct.bIsUniqueName;
+		Record.bIsClass = Struct.bIsClass;
+		Record.bIsFinal = Struct.bIsFinal;
+	}
+
+	std::vector<IRFile::Function> Functions;
+	Functions.reserve(IR.Functions.size());
+
+	for (const IRFunction& Function : IR.Functions)
+	{
+		IRFile::Function& Record = Functions.emplace_back();
+		Record.RawName = AddString(Function.RawName);
+		Record.Name = AddString(Function.Name);
+		Record.UniqueName = AddString(Function.UniqueName);
+		Record.OuterIndex = Function.OuterIndex;
+		Record.FunctionFlags = static_cast<uint32>(Function.FunctionFlags);
+		Record.ExecFunctionOffset = Function.ExecFunctionOffset;
+		Record.ParamStructSize = Function.ParamStructSize;
+		Record.ParamsOffset = Function.ParamsOffset;
+		Record.NumParams = Function.NumParams;
+	}
+
+	std::vector<IRFile::Enum> Enums;
+	Enums.reserve(IR.Enums.size());
+
+	for (const IREnum& Enum : IR.Enums)
+	{
+		IRFile::Enum& Record = Enums.emplace_back();
+		Record.RawName = AddString(Enum.RawName);
+		Record.UniqueName = AddString(Enum.UniqueName);
+		Record.MembersOffset = Enum.MembersOffset;
+		Record.NumMembers = Enum.NumMembers;
+		Record.bIsUniqueName = Enum.bIsUniqueName;
+		Record.UnderlyingTypeSize = Enum.UnderlyingTypeSize;
+	}
+
+	std::vector<IRFile::Member> Members;
+	Members.reserve(IR.Members.size());
+
+	for (const IRMember& Member : IR.Members)
+	{
+		IRFile::Member& Record = Members.emplace_back();
+		Record.RawName = AddString(Member.RawName);
+		Record.UniqueName = AddString(Member.UniqueName);
+		Record.PropertyFlags = static_cast<uint64>(Member.PropertyFlags);
+		Record.Offset = Member.Offset;
+		Record.Size = Member.Size;
+		Record.ArrayDim = Member.ArrayDim;
+		Record.TypeIndex = Member.TypeIndex;
+		Record.bIsBitField = Member.bIsBitField;
+		Record.BitIndex = Member.BitIndex;
+		Record.FieldMask = Member.FieldMask;
+	}
+
+	std::vector<IRFile::PropType> PropertyTypes;
+	PropertyTypes.reserve(IR.PropertyTypes.size());
+
+	for (const IRPropertyType& Type : IR.PropertyTypes)
+	{
+		IRFile::PropType& Record = PropertyTypes.emplace_back();
+		Record.CastFlags = static_cast<uint64>(Type.CastFlags);
+		Record.ReferencedStructIndex = Type.ReferencedStructIndex;
+		Record.ReferencedEnumIndex = Type.ReferencedEnumIndex;
+		Record.InnerTypes[0] = Type.InnerTypes[0];
+		Record.InnerTypes[1] = Type.InnerTypes[1];
+	}
+
+	std::vector<IRFile::EnumMember> EnumMembers;
+	EnumMembers.reserve(IR.EnumMembers.size());
+
+	for (const IREnumMember& Member : IR.EnumMembers)
+		EnumMembers.push_back({ Member.Value, AddString(Member.UniqueName) });
+
+	IRFile::Header Header = {};
+	Header.Magic = IRFile::Magic;
+	Header.Version = IRFile::Version;
+	Header.NumPackages = static_cast<uint32>(Packages.size());
+	Header.NumStructs = static_cast<uint32>(Structs.size());
+	Header.NumFunctions = static_cast<uint32>(Functions.size());
+	Header.NumEnums = static_cast<uint32>(Enums.size());
+	Header.NumMembers = static_cast<uint32>(Members.size());
+	Header.NumPropertyTypes = static_cast<uint32>(PropertyTypes.size());
+	Header.NumEnumMembers = static_cast<uint32>(EnumMembers.size());
+	Header.NumFunctionIndices = static_cast<uint32>(IR.FunctionIndices.size());
+	Header.NumPackageIndices = static_cast<uint32>(PackageIndices.size());
+	Header.GameName = AddString(Settings::Generator::GameName);
+	Header.GameVersion = AddString(Settings::Generator::GameVersion);
+	Header.StringPoolSize = static_cast<uint32>(StringPool.size());
+
+	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
+	std::ofstream File(FilePath, std::ios::binary);
+
+	if (!File.is_open())
+	{
+		std::cerr << std::format("IRManager: Could not open '{}' for writing!\n", FilePath.string());
+		return false;
+	}
+
+	uint64 WrittenSize = 0x0;
+
+	auto WriteSection = [&File, &WrittenSize](const void* Data, uint64 Size) -> void
+	{
+		constexpr char Padding[0x8] = { 0x0 };
+
+		File.write(static_cast<const char*>(Data), Size);
+		WrittenSize += Size;
+
+		/* Every section starts 8-byte aligned, so the records can be read in place */
+		const uint64 PaddingSize = Align(WrittenSize, static_cast<uint64>(0x8)) - WrittenSize;
+
+		File.write(Padding, PaddingSize);
+		WrittenSize += PaddingSize;
+	};
+
+	WriteSection(&Header, sizeof(Header));
+	WriteSection(Packages.data(), Packages.size() * sizeof(IRFile::Package));
+	WriteSection(Structs.data(), Structs.size() * sizeof(IRFile::Struct));
+	WriteSection(Functions.data(), Functions.size() * sizeof(IRFile::Function));
+	WriteSection(Enums.data(), Enums.size() * sizeof(IRFile::Enum));
+	WriteSection(Members.data(), Members.size() * sizeof(IRFile::Member));
+	WriteSection(PropertyTypes.data(), PropertyTypes.size() * sizeof(IRFile::PropType));
+	WriteSection(EnumMembers.data(), EnumMembers.size() * sizeof(IRFile::EnumMember));
+	WriteSection(IR.FunctionIndices.data(), IR.FunctionIndices.size() * sizeof(int32));
+	WriteSection(PackageIndices.data(), PackageIndices.size() * sizeof(int32));
+	WriteSection(StringPool.data(), StringPool.size());
+
+	return File.good();
+}
+
+bool IRManager::LoadFromFile(const std::filesystem::path& FilePath)
+{
+	std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+
+	if (!File.is_open())
+	{
+		std::cerr << std::format("IRManager: Could not open '{}'!\n", FilePath.string());
+		return false;
+	}
+
+	std::vector<uint8> FileData(static_cast<size_t>(File.tellg()));
+
+	File.seekg(0);
+	File.read(reinterpret_cast<char*>(FileData.data()), FileData.size());
+
+	uint64 ReadOffset = 0x0;
+	bool bIsValidFile = true;
+
+	/* Returns the next section of the file, or nullptr if the file is too small to contain it */
+	auto ReadSection = [&](uint32 Count, uint64 RecordSize) -> const uint8*
+	{
+		const uint64 Size = Count * RecordSize;
+
+		if (!bIsValidFile || (ReadOffset + Size) > FileData.size())
+		{
+			bIsValidFile = false;
+			return nullptr;
+		}
+
+		const uint8* Section = FileData.data() + ReadOffset;
+		ReadOffset = Align(ReadOffset + Size, static_cast<uint64>(0x8));
+
+		return Section;
+	};
+
+	const IRFile::Header* Header = reinterpret_cast<const IRFile::Header*>(ReadSection(1, sizeof(IRFile::Header)));
+
+	if (!Header || Header->Magic != IRFile::Magic || Header->Version != IRFile::Version)
+	{
+		std::cerr << std::format("IRManager: '{}' is not a valid SDKIR file of version {}!\n", FilePath.string(), IRFile::Version);
+		return false;
+	}
+
+	const IRFile::Package* Packages = reinterpret_cast<const IRFile::Package*>(ReadSection(Header->NumPackages, sizeof(IRFile::Package)));
+	const IRFile::Struct* Structs = reinterpret_cast<const IRFile::Struct*>(ReadSection(Header->NumStructs, sizeof(IRFile::Struct)));
+	const IRFile::Function* Functions = reinterpret_cast<const IRFile::Function*>(ReadSection(Header->NumFunctions, sizeof(IRFile::Function)));
+	const IRFile::Enum* Enums = reinterpret_cast<const IRFile::Enum*>(ReadSection(Header->NumEnums, sizeof(IRFile::Enum)));
+	const IRFile::Member* Members = reinterpret_cast<const IRFile::Member*>(ReadSection(Header->NumMembers, sizeof(IRFile::Member)));
+	const IRFile::PropType* PropertyTypes = reinterpret_cast<const IRFile::PropType*>(ReadSection(Header->NumPropertyTypes, sizeof(IRFile::PropType)));
+	const IRFile::EnumMember* EnumMembers = reinterpret_cast<const IRFile::EnumMember*>(ReadSection(Header->NumEnumMembers, sizeof(IRFile::EnumMember)));
+	const int32* FunctionIndices = reinterpret_cast<const int32*>(ReadSection(Header->NumFunctionIndices, sizeof(int32)));
+	const int32* PackageIndices = reinterpret_cast<const int32*>(ReadSection(Header->NumPackageIndices, sizeof(int32)));
+	const char* StringPool = reinterpret_cast<const char*>(ReadSection(Header->StringPoolSize, sizeof(char)));
+
+	if (!bIsValidFile)
+	{
+		std::cerr << std::format("IRManager: '{}' is truncated!\n", FilePath.string());
+		return false;
+	}
+
+	auto GetString = [&](IRFile::StringRef Ref) -> std::string
+	{
+		if ((static_cast<uint64>(Ref.Offset) + Ref.Length) > Header->StringPoolSize)
+		{
+			bIsValidFile = false;
+			return "";
+		}
+
+		return std::string(StringPool + Ref.Offset, Ref.Length);
+	};
+
+	auto GetIndices = [&](int32 Offset, int32 Num) -> std::vector<int32>
+	{
+		if (Offset < 0 || Num < 0 || (static_cast<uint64>(Offset) + Num) > Header->NumPackageIndices)
+		{
+			bIsValidFile = false;
+			return {};
+		}
+
+		return std::vector<int32>(PackageIndices + Offset, PackageIndices + Offset + Num);
+	};
+
+	SDKIR NewIR;
+
+	NewIR.Packages.reserve(Header->NumPackages);
+	NewIR.Structs.reserve(Header->NumStructs);
+	NewIR.Functions.reserve(Header->NumFunctions);
+	NewIR.Enums.reserve(Header->NumEnums);
+	NewIR.Members.reserve(Header->NumMembers);
+	NewIR.PropertyTypes.reserve(Header->NumPropertyTypes);
+	NewIR.EnumMembers.reserve(Header->NumEnumMembers);
+
+	for (const IRFile::Package& Record : std::span(Packages, Header->NumPackages))
+	{
+		IRPackage& Package = NewIR.Packages.emplace_back();
+		Package.Name = GetString(Record.Name);
+		Package.bIsEmpty = Record.bIsEmpty;
+		Package.Enums = GetIndices(Record.EnumsOffset, Record.NumEnums);
+		Package.SortedStructs = GetIndices(Record.StructsOffset, Record.NumStructs);
+		Package.SortedClasses = GetIndices(Record.ClassesOffset, Record.NumClasses);
+	}
+
+	for (const IRFile::Struct& Record : std::span(Structs, Header->NumStructs))
+	{
+		IRStruct& Struct = NewIR.Structs.emplace_back();
+		Struct.RawName = GetString(Record.RawName);
+		Struct.CppName = GetString(Record.CppName);
+		Struct.UniqueName = GetString(Record.UniqueName);
+		Struct.bIsUniqueName = Record.bIsUniqueName;
+		Struct.PackageIndex = Record.PackageIndex;
+		Struct.SuperIndex = Record.SuperIndex;
+		Struct.Size = Record.Size;
+		Struct.Alignment = Record.Alignment;
+		Struct.bIsClass = Record.bIsClass;
+		Struct.bIsFinal = Record.bIsFinal;
+		Struct.VftOffset = Record.VftOffset;
+		Struct.MembersOffset = Record.MembersOffset;
+		Struct.NumMembers = Record.NumMembers;
+		Struct.FunctionsOffset = Record.FunctionsOffset;
+		Struct.NumFunctions = Record.NumFunctions;
+	}
+
+	for (const IRFile::Function& Record : std::span(Functions, Header->NumFunctions))
+	{
+		IRFunction& Function = NewIR.Functions.emplace_back();
+		Function.RawName = GetString(Record.RawName);
+		Function.Name = GetString(Record.Name);
+		Function.UniqueName = GetString(Record.UniqueName);
+		Function.OuterIndex = Record.OuterIndex;
+		Function.FunctionFlags = static_cast<EFunctionFlags>(Record.FunctionFlags);
+		Function.ExecFunctionOffset = Record.ExecFunctionOffset;
+		Function.ParamStructSize = Record.ParamStructSize;
+		Function.ParamsOffset = Record.ParamsOffset;
+		Function.NumParams = Record.NumParams;
+	}
+
+	for (const IRFile::Enum& Record : std::span(Enums, Header->NumEnums))
+	{
+		IREnum& Enum = NewIR.Enums.emplace_back();
+		Enum.RawName = GetString(Record.RawName);
+		Enum.UniqueName = GetString(Record.UniqueName);
+		Enum.bIsUniqueName = Record.bIsUniqueName;
+		Enum.UnderlyingTypeSize = Record.UnderlyingTypeSize;
+		Enum.MembersOffset = Record.MembersOffset;
+		Enum.NumMembers = Record.NumMembers;
+	}
+
+	for (const IRFile::Member& Record : std::span(Members, Header->NumMembers))
+	{
+		IRMember& Member = NewIR.Members.emplace_back();
+		Member.RawName = GetString(Record.RawName);
+		Member.UniqueName = GetString(Record.UniqueName);
+		Member.Offset = Record.Offset;
+		Member.Size = Record.Size;
+		Member.ArrayDim = Record.ArrayDim;
+		Member.PropertyFlags = static_cast<EPropertyFlags>(Record.PropertyFlags);
+		Member.bIsBitField = Record.bIsBitField;
+		Member.BitIndex = Record.BitIndex;
+		Member.FieldMask = Record.FieldMask;
+		Member.TypeIndex = Record.TypeIndex;
+	}
+
+	for (const IRFile::PropType& Record : std::span(PropertyTypes, Header->NumPropertyTypes))
+	{
+		IRPropertyType& Type = NewIR.PropertyTypes.emplace_back();
+		Type.CastFlags = static_cast<EClassCastFlags>(Record.CastFlags);
+		Type.ReferencedStructIndex = Record.ReferencedStructIndex;
+		Type.ReferencedEnumIndex = Record.ReferencedEnumIndex;
+		Type.InnerTypes[0] = Record.InnerTypes[0];
+		Type.InnerTypes[1] = Record.InnerTypes[1];
+	}
+
+	for (const IRFile::EnumMember& Record : std::span(EnumMembers, Header->NumEnumMembers))
+		NewIR.EnumMembers.push_back({ GetString(Record.UniqueName), Record.Value });
+
+	NewIR.FunctionIndices.assign(FunctionIndices, FunctionIndices + Header->NumFunctionIndices);
+
+	NewIR.GameName = GetString(Header->GameName);
+	NewIR.GameVersion = GetString(Header->GameVersion);
+
+	if (!bIsValidFile || !IsValidIR(NewIR))
+	{
+		std::cerr << std::format("IRManager: '{}' contains invalid string- or index-ranges!\n", FilePath.string());
+		return false;
+	}
+
+	IR = std::move(NewIR);
+	bIsInitialized = true;
+
+	return true;
+}
+
+bool IRManager::IsValidIR(const SDKIR& InIR)
+{
+	auto IsValidIndex = [](int32 Index, size_t Num) -> bool
+	{
+		return Index >= 0 && static_cast<size_t>(Index) < Num;
+	};
+
+	/* Offset and count of a range within an array of Num elements */
+	auto IsValidRange = [](int32 Offset, int32 Count, size_t Num) -> bool
+	{
+		return Offset >= 0 && Count >= 0 && (static_cast<size_t>(Offset) + static_cast<size_t>(Count)) <= Num;
+	};
+
+	auto AreValidIndices = [&IsValidIndex](const std::vector<int32>& Indices, size_t Num) -> bool
+	{
+		return std::all_of(Indices.begin(), Indices.end(), [&](int32 Index) { return IsValidIndex(Index, Num); });
+	};
+
+	for (const IRPackage& Package : InIR.Packages)
+	{
+		if (!AreValidIndices(Package.Enums, InIR.Enums.size()) || !AreValidIndices(Package.SortedStructs, InIR.Structs.size()) || !AreValidIndices(Package.SortedClasses, InIR.Structs.size()))
+			return false;
+	}
+
+	for (const IRStruct& Struct : InIR.Structs)
+	{
+		if (!IsValidIndex(Struct.PackageIndex, InIR.Packages.size()) || (Struct.SuperIndex != -1 && !IsValidIndex(Struct.SuperIndex, InIR.Structs.size())))
+			return false;
+
+		if (!IsValidRange(Struct.MembersOffset, Struct.NumMembers, InIR.Members.size()) || !IsValidRange(Struct.FunctionsOffset, Struct.NumFunctions, InIR.FunctionIndices.size()))
+			return false;
+	}
+
+	for (const IRFunction& Function : InIR.Functions)
+	{
+		if ((Function.OuterIndex != -1 && !IsValidIndex(Function.OuterIndex, InIR.Structs.size())) || !IsValidRange(Function.ParamsOffset, Function.NumParams, InIR.Members.size()))
+			return false;
+	}
+
+	for (const IREnum& Enum : InIR.Enums)
+	{
+		if (!IsValidRange(Enum.MembersOffset, Enum.NumMembers, InIR.EnumMembers.size()))
+			return false;
+	}
+
+	for (const IRMember& Member : InIR.Members)
+	{
+		if (Member.TypeIndex != -1 && !IsValidIndex(Member.TypeIndex, InIR.PropertyTypes.size()))
+			return false;
+	}
+
+	for (const IRPropertyType& Type : InIR.PropertyTypes)
+	{
+		if ((Type.ReferencedStructIndex != -1 && !IsValidIndex(Type.ReferencedStructIndex, InIR.Structs.size())) || (Type.ReferencedEnumIndex != -1 && !IsValidIndex(Type.ReferencedEnumIndex, InIR.Enums.size())))
+			return false;
+
+		for (const int32 InnerType : Type.InnerTypes)
+		{
+			if (InnerType != -1 && !IsValidIndex(InnerType, InIR.PropertyTypes.size()))
+				return false;
+		}
+	}
+
+	return AreValidIndices(InIR.FunctionIndices, InIR.Functions.size());
+}
@@ -3,35 +3,70 @@
 #include "Managers/MemberManager.h"
 #include "Wrappers/MemberWrappers.h"
 
-MemberManager::MemberManager(UEStruct Str)
-	: Struct(std::make_shared<StructWrapper>(Str))
-	, Functions(Str.GetFunctions())
-	, Members(Str.GetProperties())
+namespace MemberManagerUtils
+{
+	/* Sorts Elements and keeps every NameInfo at the same position as the element it belongs to */
+	template<typename UEType>
+	inline void SortWithNameInfos(std::vector<UEType>& Elements, std::vector<NameInfo>& NameInfos, bool(*Compare)(UEType, UEType))
+	{
+		std::vector<std::pair<UEType, NameInfo>> Pairs;
+		Pairs.reserve(Elements.size());
+
+		for (int i = 0; i < Elements.size(); i++)
+			Pairs.emplace_back(Elements[i], NameInfos[i]);
+
+		std::sort(Pairs.begin(), Pairs.end(), [Compare](const std::pair<UEType, NameInfo>& Left, const std::pair<UEType, NameInfo>& Right) -> bool
+		{
+			return Compare(Left.first, Right.first);
+		});
+
+		for (int i = 0; i < Pairs.size(); i++)
+		{
+			Elements[i] = Pairs[i].first;
+			NameInfos[i] = Pairs[i].second;
+		}
+	}
+}
+
+MemberManager::MemberManager(const SortedMemberView& View)
+	: Struct(View.Struct)
+	, Members(SortedMembers.data() + View.MembersOffset, View.NumMembers)
+	, Functions(SortedFunctions.data() + View.FunctionsOffset, View.NumFunctions)
+	, MemberNameInfos(SortedMemberNameInfos.data() + View.MembersOffset, View.NumMembers)
+	, FunctionNameInfos(SortedFunctionNameInfos.data() + View.FunctionsOffset, View.NumFunctions)
 {
-	// sorts functions/members in O(n * log(n)), can be sorted via radix, O(n), but the overhead might not be worth it
-	std::sort(Functions.begin(), Functions.end(), CompareUnrealFunctions);
-	std::sort(Members.begin(), Members.end(), CompareUnrealProperties);
+}
 
+MemberManager::MemberManager(UEStruct Str)
+	: MemberManager(GetSortedView(Str))
+{
 	if (!PredefinedMemberLookup)
 		return;
 
-	auto It = PredefinedMemberLookup->find(Struct->GetUnrealStruct().GetIndex());
-	if (It != PredefinedMemberLookup->end())
+	if (const PredefinedElements* Predefs = PredefinedMemberLookup->Find(Str.GetIndex()))
 	{
-		PredefMembers = &It->second.Members;
-		PredefFunctions = &It->second.Functions;
+		PredefMembers = &Predefs->Members;
+		PredefFunctions = &Predefs->Functions;
 	}
 }
 
 MemberManager::MemberManager(const PredefinedStruct* Str)
 	: Struct(std::make_shared<StructWrapper>(Str))
-	, Functions()
-	, Members()
 	, PredefMembers(&Str->Properties)
 	, PredefFunctions(&Str->Functions)
 {
 }
 
+const MemberManager::SortedMemberView& MemberManager::GetSortedView(UEStruct Str)
+{
+	const int32 Index = Str.GetIndex();
+
+	if (DenseIndexManager::GetType(Index) == EDenseIndexType::Function)
+		return FunctionViews.at(DenseIndexManager::GetDenseIndex(Index, EDenseIndexType::Function));
+
+	return StructViews.at(DenseIndexManager::GetDenseIndex(Index, EDenseIndexType::Struct));
+}
+
 int32 MemberManager::GetNumFunctions() const
 {
 	return Functions.size();
@@ -64,12 +99,12 @@ bool MemberManager::HasMembers() const
 
 MemberIterator<true> MemberManager::IterateMembers() const
 {
-	return MemberIterator<true>(Struct, Members, PredefMembers);
+	return MemberIterator<true>(Struct, Members, MemberNameInfos, PredefMembers);
 }
 
 FunctionIterator<true> MemberManager::IterateFunctions() const
 {
-	return FunctionIterator<true>(Struct, Functions, PredefFunctions);
+	return FunctionIterator<true>(Struct, Functions, FunctionNameInfos, PredefFunctions);
 }
 
 void MemberManager::InitReservedNames()
@@ -208,3 +243,54 @@ void MemberManager::FixIncorrectNames()
 	if (const UEProperty PitchProperty = RotatorStruct.FindMember("roll"))
 		StructManager_NameAccessHelper::ReplaceName(MemberNames, RotatorStruct, PitchProperty, "Roll");
 }
+
+void MemberManager::InitSortedMembers()
+{
+	if (bIsSortedMembersInitialized)
+		return;
+
+	bIsSortedMembersInitialized = true;
+
+	StructViews.resize(DenseIndexManager::GetNum(EDenseIndexType::Struct));
+	FunctionViews.resize(DenseIndexManager::GetNum(EDenseIndexType::Function));
+
+	auto AddSortedView = [](SortedMemberView& View, UEStruct Str) -> void
+	{
+		std::vector<UEProperty> Members = Str.GetProperties();
+		std::vector<UEFunction> Functions = Str.GetFunctions();
+
+		std::vector<NameInfo> MemberNameInfos;
+		std::vector<NameInfo> FunctionNameInfos;
+
+		/* NameInfos are stored in field order, properties first and functions afterwards */
+		if (!Members.empty() || !Functions.empty())
+		{
+			const std::span<const NameInfo> NameInfos = MemberNames.GetNameCollisionInfos(Str);
+
+			MemberNameInfos.assign(NameInfos.begin(), NameInfos.begin() + Members.size());
+			FunctionNameInfos.assign(NameInfos.begin() + Members.size(), NameInfos.begin() + Members.size() + Functions.size());
+		}
+
+		// sorts functions/members in O(n * log(n)), can be sorted via radix, O(n), but the overhead might not be worth it
+		MemberManagerUtils::SortWithNameInfos(Functions, FunctionNameInfos, CompareUnrealFunctions);
+		MemberManagerUtils::SortWithNameInfos(Members, MemberNameInfos, CompareUnrealProperties);
+
+		View.Struct = std::make_shared<StructWrapper>(Str);
+
+		View.MembersOffset = static_cast<int32>(SortedMembers.size());
+		View.NumMembers = static_cast<int32>(Members.size());
+		View.FunctionsOffset = static_cast<int32>(SortedFunctions.size());
+		View.NumFunctions = static_cast<int32>(Functions.size());
+
+		SortedMembers.insert(SortedMembers.end(), Members.begin(), Members.end());
+		SortedMemberNameInfos.insert(SortedMemberNameInfos.end(), MemberNameInfos.begin(), MemberNameInfos.end());
+		SortedFunctions.insert(SortedFunctions.end(), Functions.begin(), Functions.end());
+		SortedFunctionNameInfos.insert(SortedFunctionNameInfos.end(), FunctionNameInfos.begin(), FunctionNameInfos.end());
+	};
+
+	for (int32 i = 0; i < StructViews.size(); i++)
+		AddSortedView(StructViews[i], ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Struct)));
+
+	for (int32 i = 0; i < FunctionViews.size(); i++)
+		AddSortedView(FunctionViews[i], ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Function)));
+}
@@ -5,6 +5,8 @@
 /* Required for marking cyclic-headers in the StructManager */
 #include "Managers/StructManager.h"
 
+#include "../Settings.h"
+
 inline void BooleanOrEqual(bool& b1, bool b2)
 {
 	b1 = b1 || b2;
@@ -186,15 +188,27 @@ namespace PackageManagerUtils
 		return Dependencies;
 	}
 
-	inline void SetPackageDependencies(DependencyListType& DependencyTracker, const std::unordered_set<int32>& Dependencies, int32 StructPackageIdx, bool bAllowToIncludeOwnPackage = false)
+	inline void SetPackageDependencies(DependencyListType& DependencyTracker, ForwardDeclarationListType& ForwardDeclarationTracker, const std::unordered_set<int32>& Dependencies, int32 StructPackageIdx, bool bAllowToIncludeOwnPackage = false)
 	{
 		for (int32 Dependency : Dependencies)
 		{
-			const int32 PackageIdx = ObjectArray::GetByIndex(Dependency).GetPackageIndex();
+			UEObject DependencyObject = ObjectArray::GetByIndex(Dependency);
+
+			const int32 PackageIdx = DependencyObject.GetPackageIndex();
 
 
 			if (bAllowToIncludeOwnPackage || PackageIdx != StructPackageIdx)
 			{
+				/* Enums don't require their package to be included */
+				if constexpr (Settings::CppGenerator::bGenerateForwardDeclarationHeaders)
+				{
+					if (DependencyObject.IsA(EClassCastFlags::Enum))
+					{
+						ForwardDeclarationTracker.insert(PackageIdx);
+						continue;
+					}
+				}
+
 				RequirementInfo& ReqInfo = DependencyTracker[PackageIdx];
 				ReqInfo.PackageIdx = PackageIdx;
 				ReqInfo.bShouldIncludeStructs = true; // Dependencies only contains structs/enums which are in the "PackageName_structs.hpp" file
@@ -202,7 +216,7 @@ namespace PackageManagerUtils
 		}
 	}
 
-	inline void AddEnumPackageDependencies(DependencyListType& DependencyTracker, const std::unordered_set<int32>& Dependencies, int32 StructPackageIdx, bool bAllowToIncludeOwnPackage = false)
+	inline void AddEnumPackageDependencies(DependencyListType& DependencyTracker, ForwardDeclarationListType& ForwardDeclarationTracker, const std::unordered_set<int32>& Dependencies, int32 StructPackageIdx, bool bAllowToIncludeOwnPackage = false)
 	{
 		for (int32 Dependency : Dependencies)
 		{
@@ -215,6 +229,12 @@ namespace PackageManagerUtils
 
 			if (bAllowToIncludeOwnPackage || PackageIdx != StructPackageIdx)
 			{
+				if constexpr (Settings::CppGenerator::bGenerateForwardDeclarationHeaders)
+				{
+					ForwardDeclarationTracker.insert(PackageIdx);
+					continue;
+				}
+
 				RequirementInfo& ReqInfo = DependencyTracker[PackageIdx];
 				ReqInfo.PackageIdx = PackageIdx;
 				ReqInfo.bShouldIncludeStructs = true; // Dependencies only contains enums which are in the "PackageName_structs.hpp" file
@@ -242,94 +262,87 @@ void PackageManager::InitDependencies()
 {
 	// Collects all packages required to compile this file
 
-	for (auto Obj : ObjectArray())
+	for (const int32 StructIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Struct))
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-			continue;
-
-		int32 CurrentPackageIdx = Obj.GetPackageIndex();
+		UEStruct ObjAsStruct = ObjectArray::GetByIndex<UEStruct>(StructIdx);
 
-		const bool bIsStruct = Obj.IsA(EClassCastFlags::Struct);
-		const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
+		const bool bIsClass = ObjAsStruct.IsA(EClassCastFlags::Class);
 
-		const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
-		const bool bIsEnum = Obj.IsA(EClassCastFlags::Enum);
+		const int32 StructPackageIdx = ObjAsStruct.GetPackageIndex();
 
-		if (bIsStruct && !bIsFunction)
-		{
-			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
-			Info.PackageIndex = CurrentPackageIdx;
+		PackageInfo& Info = GetInfoRef(StructPackageIdx);
 
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+		DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
+		ForwardDeclarationListType& PackageForwardDeclarationList = bIsClass ? Info.PackageDependencies.ClassesForwardDeclarations : Info.PackageDependencies.StructsForwardDeclarations;
+		DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
 
-			const int32 StructIdx = ObjAsStruct.GetIndex();
-			const int32 StructPackageIdx = ObjAsStruct.GetPackageIndex();
+		std::unordered_set<int32> Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, StructIdx);
 
-			DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
-			DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
+		ClassOrStructDependencyList.SetExists(StructIdx);
 
-			std::unordered_set<int32> Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, StructIdx);
+		PackageManagerUtils::SetPackageDependencies(PackageDependencyList, PackageForwardDeclarationList, Dependencies, StructPackageIdx, bIsClass);
 
-			ClassOrStructDependencyList.SetExists(StructIdx);
+		if (!bIsClass)
+			PackageManagerUtils::AddStructDependencies(ClassOrStructDependencyList, Dependencies, StructIdx, StructPackageIdx);
 
-			PackageManagerUtils::SetPackageDependencies(PackageDependencyList, Dependencies, StructPackageIdx, bIsClass);
-
-			if (!bIsClass)
-				PackageManagerUtils::AddStructDependencies(ClassOrStructDependencyList, Dependencies, StructIdx, StructPackageIdx);
+		/* for both struct and class */
+		if (UEStruct Super = ObjAsStruct.GetSuper())
+		{
+			const int32 SuperPackageIdx = Super.GetPackageIndex();
 
-			/* for both struct and class */
-			if (UEStruct Super = ObjAsStruct.GetSuper())
+			if (SuperPackageIdx == StructPackageIdx)
 			{
-				const int32 SuperPackageIdx = Super.GetPackageIndex();
-
-				if (SuperPackageIdx == StructPackageIdx)
-				{
-					/* In-file sorting is only required if the super-class is inside of the same package */
-					ClassOrStructDependencyList.AddDependency(Obj.GetIndex(), Super.GetIndex());
-				}
-				else
-				{
-					/* A package can't depend on itself, super of a structs will always be in _"structs" file, same for classes and "_classes" files */
-					RequirementInfo& ReqInfo = PackageDependencyList[SuperPackageIdx];
-					BooleanOrEqual(ReqInfo.bShouldIncludeStructs, !bIsClass);
-					BooleanOrEqual(ReqInfo.bShouldIncludeClasses, bIsClass);
-				}
+				/* In-file sorting is only required if the super-class is inside of the same package */
+				ClassOrStructDependencyList.AddDependency(StructIdx, Super.GetIndex());
 			}
-
-			if (!bIsClass)
-				continue;
-			
-			/* Add class-functions to package */
-			for (UEFunction Func : ObjAsStruct.GetFunctions())
+			else
 			{
-				Info.Functions.push_back(Func.GetIndex());
+				/* A package can't depend on itself, super of a structs will always be in _"structs" file, same for classes and "_classes" files */
+				RequirementInfo& ReqInfo = PackageDependencyList[SuperPackageIdx];
+				BooleanOrEqual(ReqInfo.bShouldIncludeStructs, !bIsClass);
+				BooleanOrEqual(ReqInfo.bShouldIncludeClasses, bIsClass);
+			}
+		}
+
+		if (!bIsClass)
+			continue;
+		
+		/* Add class-functions to package */
+		for (UEFunction Func : ObjAsStruct.GetFunctions())
+		{
+			Info.Functions.push_back(Func.GetIndex());
 
-				std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
+			std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
 
-				BooleanOrEqual(Info.bHasParams, Func.HasMembers());
+			BooleanOrEqual(Info.bHasParams, Func.HasMembers());
 
-				const int32 FuncPackageIndex = Func.GetPackageIndex();
+			const int32 FuncPackageIndex = Func.GetPackageIndex();
 
-				/* Add dependencies to ParamDependencies and add enums only to class dependencies (forwarddeclaration of enum classes defaults to int) */
-				PackageManagerUtils::SetPackageDependencies(Info.PackageDependencies.ParametersDependencies, ParamDependencies, FuncPackageIndex, true);
-				PackageManagerUtils::AddEnumPackageDependencies(Info.PackageDependencies.ClassesDependencies, ParamDependencies, FuncPackageIndex, true);
-			}
+			/* Add dependencies to ParamDependencies and add enums only to class dependencies (forwarddeclaration of enum classes defaults to int) */
+			PackageManagerUtils::SetPackageDependencies(Info.PackageDependencies.ParametersDependencies, Info.PackageDependencies.ParametersForwardDeclarations, ParamDependencies, FuncPackageIndex, true);
+			PackageManagerUtils::AddEnumPackageDependencies(Info.PackageDependencies.ClassesDependencies, Info.PackageDependencies.ClassesForwardDeclarations, ParamDependencies, FuncPackageIndex, true);
 		}
-		else if (bIsEnum)
-		{
-			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
-			Info.PackageIndex = CurrentPackageIdx;
+	}
 
-			Info.Enums.push_back(Obj.GetIndex());
-		}
+	for (const int32 EnumIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Enum))
+	{
+		PackageInfo& Info = GetInfoRef(ObjectArray::GetByIndex(EnumIdx).GetPackageIndex());
+
+		Info.Enums.push_back(EnumIdx);
+	}
+
+	for (PackageInfo& Info : PackageInfos)
+	{
+		Info.StructsSorted.Finalize();
+		Info.ClassesSorted.Finalize();
 	}
 }
 
 void PackageManager::InitNames()
 {
-	for (auto& [PackageIdx, Info] : PackageInfos)
+	for (PackageInfo& Info : PackageInfos)
 	{
-		const std::string PackageName = ObjectArray::GetByIndex(PackageIdx).GetValidName();
+		const std::string PackageName = ObjectArray::GetByIndex(Info.PackageIndex).GetValidName();
 
 		auto [Name, bWasInserted] = UniquePackageNameTable.FindOrAdd(PackageName);
 		Info.Name = Name;
@@ -408,7 +421,7 @@ void PackageManager::HelperAddEnumsFromPacakageToFwdDeclarations(UEStruct Struct
 
 void PackageManager::HelperInitEnumFwdDeclarationsForPackage(int32 PackageForFwdDeclarations, int32 RequiredPackage, bool bIsClass)
 {
-	PackageInfo& Info = PackageInfos.at(PackageForFwdDeclarations);
+	PackageInfo& Info = GetInfoRef(PackageForFwdDeclarations);
 
 	std::vector<std::pair<int32, bool>>& EnumsToForwardDeclare = Info.EnumForwardDeclarations;
 
@@ -445,10 +458,10 @@ void PackageManager::HandleCycles()
 	std::vector<CycleInfo> HandledPackages;
 
 
-	FindCycleCallbackType CleanedUpOnCycleFoundCallback = [&HandledPackages](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	FindCycleCallbackType CleanedUpOnCycleFoundCallback = [&HandledPackages](const PackageManagerIterationParams& Params, bool bIsStruct) -> void
 	{
-		const int32 CurrentPackageIndex = NewParams.RequiredPackage;
-		const int32 PreviousPackageIndex = NewParams.PrevPackage;
+		const int32 CurrentPackageIndex = Params.RequiredPackage;
+		const int32 PreviousPackageIndex = Params.PrevPackage;
 
 		/* Check if this pacakge was handled before, return if true */
 		for (const CycleInfo& Cycle : HandledPackages)
@@ -576,7 +589,10 @@ void PackageManager::Init()
 
 	bIsInitialized = true;
 
-	PackageInfos.reserve(0x800);
+	PackageInfos.resize(DenseIndexManager::GetNum(EDenseIndexType::Package));
+
+	for (int32 i = 0; i < PackageInfos.size(); i++)
+		PackageInfos[i].PackageIndex = DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Package);
 
 	InitDependencies();
 	InitNames();
@@ -594,148 +610,194 @@ void PackageManager::PostInit()
 	HandleCycles();
 }
 
-void PackageManager::IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle)
+PackageManager::PackageDependencyGraph PackageManager::BuildPackageDependencyGraph()
 {
-	if (!Params.bShouldHandlePackage)
-		return;
+	PackageDependencyGraph RetGraph;
+	RetGraph.Graph = DependencyGraph(static_cast<int32>(PackageInfos.size() * 2));
 
-	const bool bIsIncluded = Params.IterationHitCounterRef >= CurrentIterationHitCount;
-
-	if (!bIsIncluded)
+	auto AddDependencyEdges = [&](int32 FromNode, const DependencyListType& Dependencies) -> void
 	{
-		Params.IterationHitCounterRef = CurrentIterationHitCount;
+		for (const auto& [Index, Requirements] : Dependencies)
+		{
+			const int32 RequiredDenseIndex = DenseIndexManager::GetDenseIndex(Requirements.PackageIdx, EDenseIndexType::Package);
 
-		IncludeData& Include = Params.VisitedNodes[Params.CurrentIndex];
-		Include.bIncludedStructs = (Include.bIncludedStructs || Params.bIsStruct);
-		Include.bIncludedClasses = (Include.bIncludedClasses || !Params.bIsStruct);
+			if (RequiredDenseIndex == -1)
+				continue;
 
-		for (auto& [Index, Requirements] : Params.Dependencies)
-		{
-			Params.NewParams.bWasPrevNodeStructs = Params.bIsStruct;
-			Params.NewParams.bRequiresClasses = Requirements.bShouldIncludeClasses;
-			Params.NewParams.bRequiresStructs = Requirements.bShouldIncludeStructs;
-			Params.NewParams.RequiredPackage = Requirements.PackageIdx;
+			if (Requirements.bShouldIncludeStructs)
+				RetGraph.Graph.AddEdge(FromNode, PackageDependencyGraph::GetNode(RequiredDenseIndex, true));
 
-			/* Iterate dependencies recursively */
-			IterateDependenciesImplementation(Params.NewParams, Params.CallbackForEachPackage, Params.OnFoundCycle, bCheckForCycle);
+			if (Requirements.bShouldIncludeClasses)
+				RetGraph.Graph.AddEdge(FromNode, PackageDependencyGraph::GetNode(RequiredDenseIndex, false));
 		}
+	};
 
-		Params.VisitedNodes.erase(Params.CurrentIndex);
+	/* Nodes are in the order of PackageInfos, it decides the order of includes and which cycles are found first */
+	for (int32 i = 0; i < PackageInfos.size(); i++)
+	{
+		const DependencyInfo& Dependencies = PackageInfos[i].PackageDependencies;
 
-		// PERFORM ACTION
-		Params.CallbackForEachPackage(Params.NewParams, Params.OldParams, Params.bIsStruct);
-		return;
+		AddDependencyEdges(PackageDependencyGraph::GetNode(i, true), Dependencies.StructsDependencies);
+		AddDependencyEdges(PackageDependencyGraph::GetNode(i, false), Dependencies.ClassesDependencies);
 	}
 
-	if (bCheckForCycle)
-	{
-		auto It = Params.VisitedNodes.find(Params.CurrentIndex);
-		if (It != Params.VisitedNodes.end())
-		{
-			if ((It->second.bIncludedStructs && Params.bIsStruct) || (It->second.bIncludedClasses && !Params.bIsStruct))
-				Params.OnFoundCycle(Params.NewParams, Params.OldParams, Params.bIsStruct);
-		}
-	}
+	RetGraph.Graph.Finalize();
+
+	return RetGraph;
 }
 
-void PackageManager::IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle)
+void PackageManager::IterateDependenciesImplementation(const PackageDependencyGraph& PackageGraph, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle)
 {
-	PackageManagerIterationParams NewParams = {
-		.PrevPackage = Params.RequiredPackage,
+	struct IterationFrame
+	{
+		int32 Node;
+		int32 PrevPackage;
+		bool bWasPrevNodeStructs;
+		int32 NextDependency;
+	};
 
-		.VisitedNodes = Params.VisitedNodes,
+	enum EIncludeFlags : uint8
+	{
+		None = 0x0,
+		IncludedStructs = 0x1,
+		IncludedClasses = 0x2,
 	};
 
-	DependencyInfo& Dependencies = PackageInfos.at(Params.RequiredPackage).PackageDependencies;
+	const DependencyGraph& Graph = PackageGraph.Graph;
 
-	SingleDependencyIterationParamsInternal StructsParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
+	std::vector<bool> VisitedNodes(Graph.GetNumNodes(), false);
 
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.StructsDependencies,
-		.VisitedNodes = Params.VisitedNodes,
+	/* EIncludeFlags for all packages which are currently being iterated */
+	std::vector<uint8> PackagesOnStack(PackageInfos.size(), EIncludeFlags::None);
 
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.StructsIterationHitCount,
+	std::vector<IterationFrame> Stack;
 
-		.bShouldHandlePackage = Params.bRequiresStructs,
-		.bIsStruct = true,
+	auto GetIncludeFlag = [](int32 Node) -> uint8
+	{
+		return PackageDependencyGraph::IsStructNode(Node) ? EIncludeFlags::IncludedStructs : EIncludeFlags::IncludedClasses;
 	};
 
-	SingleDependencyIterationParamsInternal ClassesParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
+	auto EnterNode = [&](int32 Node, int32 PrevPackage, bool bWasPrevNodeStructs) -> void
+	{
+		VisitedNodes[Node] = true;
+		PackagesOnStack[PackageDependencyGraph::GetDenseIndex(Node)] |= GetIncludeFlag(Node);
 
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.ClassesDependencies,
-		.VisitedNodes = Params.VisitedNodes,
+		Stack.push_back({ Node, PrevPackage, bWasPrevNodeStructs, 0x0 });
+	};
 
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.ClassesIterationHitCount,
+	for (int32 RootNode = 0; RootNode < Graph.GetNumNodes(); RootNode++)
+	{
+		if (VisitedNodes[RootNode])
+			continue;
 
-		.bShouldHandlePackage = Params.bRequiresClasses,
-		.bIsStruct = false,
-	};
+		EnterNode(RootNode, -1, true);
 
-	IterateSingleDependencyImplementation(StructsParams, bCheckForCycle);
-	IterateSingleDependencyImplementation(ClassesParams, bCheckForCycle);
-}
+		while (!Stack.empty())
+		{
+			IterationFrame& Frame = Stack.back();
 
-void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
-{
-	VisitedNodeContainerType VisitedNodes;
+			const int32 CurrentDenseIndex = PackageDependencyGraph::GetDenseIndex(Frame.Node);
+			const std::span<const int32> Dependencies = Graph.GetEdges(Frame.Node);
 
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
+			if (Frame.NextDependency < Dependencies.size())
+			{
+				const int32 RequiredNode = Dependencies[Frame.NextDependency++];
+				const int32 CurrentNode = Frame.Node;
 
-		.VisitedNodes = VisitedNodes,
-	};
+				if (!VisitedNodes[RequiredNode])
+				{
+					EnterNode(RequiredNode, PackageInfos[CurrentDenseIndex].PackageIndex, PackageDependencyGraph::IsStructNode(CurrentNode));
+					continue;
+				}
 
-	FindCycleCallbackType OnCycleFoundCallback = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+				/* Only edges within a cyclic SCC can lead back to a file that is still being iterated */
+				if (!bCheckForCycle || !Graph.IsEdgeInCycle(CurrentNode, RequiredNode))
+					continue;
 
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
+				const int32 RequiredDenseIndex = PackageDependencyGraph::GetDenseIndex(RequiredNode);
 
-	for (const auto& [PackageIndex, Info] : PackageInfos)
-	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+				if (PackagesOnStack[RequiredDenseIndex] & GetIncludeFlag(RequiredNode))
+				{
+					const PackageManagerIterationParams CycleParams = {
+						.PrevPackage = PackageInfos[CurrentDenseIndex].PackageIndex,
+						.RequiredPackage = PackageInfos[RequiredDenseIndex].PackageIndex,
+						.bWasPrevNodeStructs = PackageDependencyGraph::IsStructNode(CurrentNode),
+					};
+
+					OnFoundCycle(CycleParams, PackageDependencyGraph::IsStructNode(RequiredNode));
+				}
+
+				continue;
+			}
+
+			const PackageManagerIterationParams Params = {
+				.PrevPackage = Frame.PrevPackage,
+				.RequiredPackage = PackageInfos[CurrentDenseIndex].PackageIndex,
+				.bWasPrevNodeStructs = Frame.bWasPrevNodeStructs,
+			};
+			const bool bIsStruct = PackageDependencyGraph::IsStructNode(Frame.Node);
+
+			/* Finishing either file of a package clears the flags for both, identical to how the include-order was previously determined */
+			PackagesOnStack[CurrentDenseIndex] = EIncludeFlags::None;
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnCycleFoundCallback, false);
+			Stack.pop_back();
+
+			// PERFORM ACTION
+			if (CallbackForEachPackage)
+				CallbackForEachPackage(Params, bIsStruct);
+		}
 	}
 }
 
-void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
+void PackageManager::GetRequiredPackages(const std::vector<int32>& RootPackages, std::unordered_set<int32>& OutPackages, std::unordered_set<int32>& OutForwardDeclaredPackages)
 {
-	VisitedNodeContainerType VisitedNodes;
-
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
+	std::vector<int32> PackagesToVisit;
 
-		.VisitedNodes = VisitedNodes,
+	auto AddPackage = [&](int32 PackageIndex) -> void
+	{
+		if (OutPackages.insert(PackageIndex).second)
+			PackagesToVisit.push_back(PackageIndex);
 	};
 
-	FindCycleCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void {};
+	for (const int32 PackageIndex : RootPackages)
+		AddPackage(PackageIndex);
 
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
-
-	for (const auto& [PackageIndex, Info] : PackageInfos)
+	while (!PackagesToVisit.empty())
 	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+		const int32 PackageIndex = PackagesToVisit.back();
+		PackagesToVisit.pop_back();
+
+		const DependencyInfo& Dependencies = GetInfo(PackageIndex).GetPackageDependencies();
+
+		for (const DependencyListType* List : { &Dependencies.StructsDependencies, &Dependencies.ClassesDependencies, &Dependencies.ParametersDependencies })
+		{
+			for (const auto& [RequiredPackageIndex, Requirements] : *List)
+				AddPackage(RequiredPackageIndex);
+		}
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnFoundCycle, true);
+		/* '_fwd.hpp' files don't have any dependencies */
+		for (const ForwardDeclarationListType* List : { &Dependencies.StructsForwardDeclarations, &Dependencies.ClassesForwardDeclarations, &Dependencies.ParametersForwardDeclarations })
+			OutForwardDeclaredPackages.insert(List->begin(), List->end());
 	}
+
+	std::erase_if(OutForwardDeclaredPackages, [&](int32 PackageIndex) { return OutPackages.contains(PackageIndex); });
+}
+
+void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
+{
+	/* Dependencies might've been erased when handling cycles, so the graph needs to be rebuilt */
+	const PackageDependencyGraph PackageGraph = BuildPackageDependencyGraph();
+
+	IterateDependenciesImplementation(PackageGraph, CallbackForEachPackage, nullptr, false);
+}
+
+void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
+{
+	const PackageDependencyGraph PackageGraph = BuildPackageDependencyGraph();
+
+	/* No SCC with more than one file, nothing to iterate */
+	if (!PackageGraph.Graph.HasCycles())
+		return;
+
+	IterateDependenciesImplementation(PackageGraph, nullptr, OnFoundCycle, true);
 }
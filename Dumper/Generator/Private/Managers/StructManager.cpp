@@ -1,5 +1,9 @@
+#include <execution>
+#include <numeric>
+
 #include "Unreal/ObjectArray.h"
 #include "Managers/StructManager.h"
+#include "Managers/DependencyGraph.h"
 
 StructInfoHandle::StructInfoHandle(const StructInfo& InInfo)
 	: Info(&InInfo)
@@ -51,30 +55,14 @@ bool StructInfoHandle::IsPartOfCyclicPackage() const
 	return Info->bIsPartOfCyclicPackage;
 }
 
-void StructManager::InitAlignmentsAndNames()
+void StructManager::InitNames()
 {
-	constexpr int32 DefaultClassAlignment = sizeof(void*);
-
-	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
-
 	const UEClass OnlineEngineInterfaceImplClass = ObjectArray::FindClassFast("OnlineEngineInterfaceImpl");
 
-	/*
-	 *  Cache all struct objects to avoid multiple full ObjectArray iterations
-	 */
-	std::vector<UEStruct> AllStructs;
-	AllStructs.reserve(10000);
-	
-	for (auto Obj : ObjectArray())
+	/* Structs and functions in the order of GObjects, the order decides which of two colliding names is considered unique */
+	DenseIndexManager::ForEachObjectInOrder(EDenseIndexType::Struct, EDenseIndexType::Function, [&](int32 ObjectIndex, EDenseIndexType Type) -> void
 	{
-		if (Obj.IsA(EClassCastFlags::Struct))
-			AllStructs.push_back(Obj.Cast<UEStruct>());
-	}
-
-	for (auto ObjAsStruct : AllStructs)
-	{
-		// Add name to override info
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[ObjAsStruct.GetIndex()];
+		const UEStruct ObjAsStruct = ObjectArray::GetByIndex<UEStruct>(ObjectIndex);
 
 		std::string CppName = ObjAsStruct.GetCppName();
 
@@ -82,166 +70,226 @@ void StructManager::InitAlignmentsAndNames()
 		if (ObjAsStruct == OnlineEngineInterfaceImplClass) [[unlikely]]
 			CppName += '2';
 
-		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(CppName, !ObjAsStruct.IsA(EClassCastFlags::Function)).first;
+		GetInfoRef(ObjectIndex).Name = UniqueNameTable.FindOrAdd(CppName, Type != EDenseIndexType::Function).first;
+	});
+}
 
-		// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
-		if (ObjAsStruct.HasType(InterfaceClass))
-		{
-			NewOrExistingInfo.Alignment = 0x1;
-			NewOrExistingInfo.bHasReusedTrailingPadding = false;
-			NewOrExistingInfo.bIsFinal = true;
-			NewOrExistingInfo.Size = 0x0;
+/*
+* Computes alignment, size, LastMemberEnd, reused trailing padding and final-ness of all structs in a single pass over the inheritance hierarchy.
+* 
+* Alignment is inherited from the super, so levels are processed top-down (roots first). The size of a super is cut down to the lowest member-offset
+* of its children, so sizes and final-ness are processed bottom-up afterwards. Each level only depends on the results of the level before, all structs
+* within one level are processed in parallel.
+*/
+void StructManager::InitLayouts()
+{
+	constexpr int32 DefaultClassAlignment = sizeof(void*);
 
-			continue;
-		}
+	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+
+	/* Per-struct results of reading the properties, which are only needed during this pass */
+	struct MemberLayout
+	{
+		/* Offset of the first member, INT_MAX if there are no members */
+		int32 LowestOffset = INT_MAX;
 
+		/* Lowest offset of the children this struct passes on to its super, see InitSizeAndIsFinal */
+		int32 LowestOffsetForSuper = INT_MAX;
+
+		bool bHasMembers = false;
+		bool bIsInterface = false;
+	};
+
+	/* Reads the properties once, and computes everything that doesn't depend on other structs */
+	auto InitFromMembers = [](UEStruct ObjAsStruct, StructInfo& Info, MemberLayout& Layout) -> void
+	{
 		const int32 MinAlignment = ObjAsStruct.GetMinAlignment();
 		int32 HighestMemberAlignment = 0x1; // starting at 0x1 when checking **all**, not just struct-properties
 
-		// Find member with the highest alignment
+		int32 LastMemberEnd = 0x0;
+
 		for (UEProperty Property : ObjAsStruct.GetProperties())
 		{
-			int32 CurrentPropertyAlignment = Property.GetAlignment();
+			const int32 PropertyAlignment = Property.GetAlignment();
+			const int32 PropertyOffset = Property.GetOffset();
+			const int32 PropertySize = Property.GetSize();
+
+			if (PropertyAlignment > HighestMemberAlignment)
+				HighestMemberAlignment = PropertyAlignment;
+
+			if (PropertyOffset < Layout.LowestOffset)
+				Layout.LowestOffset = PropertyOffset;
 
-			if (CurrentPropertyAlignment > HighestMemberAlignment)
-				HighestMemberAlignment = CurrentPropertyAlignment;
+			if ((PropertyOffset + PropertySize) > LastMemberEnd)
+				LastMemberEnd = PropertyOffset + PropertySize;
+
+			Layout.bHasMembers = true;
 		}
 
+		Info.LastMemberEnd = LastMemberEnd;
+
 		/* On some strange games there are BlueprintGeneratedClass UClasses which don't inherit from UObject. */
-		const bool bHasSuperClass = static_cast<bool>(ObjAsStruct.GetSuper());
+		const UEStruct Super = ObjAsStruct.GetSuper();
 
 		// if Class alignment is below pointer-alignment (0x8), use pointer-alignment instead, else use whichever, MinAlignment or HighestAlignment, is bigger
-		if (ObjAsStruct.IsA(EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
+		if (ObjAsStruct.IsA(EClassCastFlags::Class) && Super && HighestMemberAlignment < DefaultClassAlignment)
 		{
-			NewOrExistingInfo.bUseExplicitAlignment = false;
-			NewOrExistingInfo.Alignment = DefaultClassAlignment;
+			Info.bUseExplicitAlignment = false;
+			Info.Alignment = DefaultClassAlignment;
 		}
 		else
 		{
-			NewOrExistingInfo.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
-			NewOrExistingInfo.Alignment = max(MinAlignment, HighestMemberAlignment);
+			Info.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
+			Info.Alignment = max(MinAlignment, HighestMemberAlignment);
 		}
-	}
 
-	// Second pass: Fix alignments based on super classes (reuse cached list)
-	for (auto ObjAsStruct : AllStructs)
+		Info.Size = ObjAsStruct.GetStructSize();
+
+		if (Info.Size == 0x0 && Super)
+			Info.Size = Super.GetStructSize();
+	};
+
+	/* Functions don't inherit alignment or size from their super, and are never used as a super by structs */
+	std::vector<int32> FunctionIndices(FunctionInfos.size());
+	std::iota(FunctionIndices.begin(), FunctionIndices.end(), 0x0);
+
+	std::for_each(std::execution::par, FunctionIndices.begin(), FunctionIndices.end(), [&](int32 DenseIndex) -> void
 	{
-		if (ObjAsStruct.IsA(EClassCastFlags::Function) || ObjAsStruct.HasType(InterfaceClass))
-			continue;
+		MemberLayout Unused;
+		InitFromMembers(ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Function)), FunctionInfos[DenseIndex], Unused);
+	});
 
-		constexpr int MaxNumSuperClasses = 0x30;
+	const int32 NumStructs = static_cast<int32>(StructInfos.size());
 
-		std::array<UEStruct, MaxNumSuperClasses> StructStack;
-		int32 NumElementsInStructStack = 0x0;
+	std::vector<int32> SuperIndices(NumStructs, -1);
+	std::vector<int32> HierarchyDepths(NumStructs, -1);
+	std::vector<MemberLayout> Layouts(NumStructs);
 
-		// Get a top to bottom list of a struct and all of its supers
-		for (UEStruct S = ObjAsStruct; S; S = S.GetSuper())
-		{
-			StructStack[NumElementsInStructStack] = S;
-			NumElementsInStructStack++;
-		}
+	/* Edges from super to child, to find the children of a struct */
+	DependencyGraph Hierarchy(NumStructs);
 
-		int32 CurrentHighestAlignment = 0x0;
+	for (int32 i = 0; i < NumStructs; i++)
+	{
+		const UEStruct Super = ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(i, EDenseIndexType::Struct)).GetSuper();
 
-		for (int i = NumElementsInStructStack - 1; i >= 0; i--)
+		if (!Super)
+			continue;
+
+		SuperIndices[i] = DenseIndexManager::GetDenseIndex(Super.GetIndex(), EDenseIndexType::Struct);
+
+		if (SuperIndices[i] == -1)
 		{
-			StructInfo& Info = StructInfoOverrides[StructStack[i].GetIndex()];
-
-			if (CurrentHighestAlignment < Info.Alignment)
-			{
-				CurrentHighestAlignment = Info.Alignment;
-			}
-			else
-			{
-				// We use the super classes' alignment, no need to explicitely set it
-				Info.bUseExplicitAlignment = false; 
-				Info.Alignment = CurrentHighestAlignment;
-			}
+			std::cerr << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfos'! Exiting...\n\n\n" << std::endl;
+			Sleep(10000);
+			exit(1);
 		}
+
+		Hierarchy.AddEdge(SuperIndices[i], i);
 	}
-}
 
-void StructManager::InitSizesAndIsFinal()
-{
-	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	Hierarchy.Finalize();
+
+	/* Depth in the inheritance hierarchy, 0 for structs without a super */
+	std::vector<std::vector<int32>> HierarchyLevels;
+	std::vector<int32> UnresolvedChain;
 
-	// Reuse cached struct list from InitAlignmentsAndNames
-	for (const auto& [Index, Info] : StructInfoOverrides)
+	for (int32 i = 0; i < NumStructs; i++)
 	{
-		UEStruct ObjAsStruct = ObjectArray::GetByIndex<UEStruct>(Index);
-		
-		if (ObjAsStruct.HasType(InterfaceClass))
-			continue;
+		for (int32 S = i; S != -1 && HierarchyDepths[S] == -1; S = SuperIndices[S])
+			UnresolvedChain.push_back(S);
 
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Index];
+		/* Resolve top-down, every struct is one level deeper than its super */
+		for (auto It = UnresolvedChain.rbegin(); It != UnresolvedChain.rend(); ++It)
+		{
+			const int32 Super = SuperIndices[*It];
+			const int32 Depth = Super != -1 ? HierarchyDepths[Super] + 1 : 0x0;
 
-		// Initialize struct-size if it wasn't set already
-		if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
-			NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
+			HierarchyDepths[*It] = Depth;
 
-		UEStruct Super = ObjAsStruct.GetSuper();
+			if (HierarchyLevels.size() <= Depth)
+				HierarchyLevels.resize(Depth + 1);
 
-		if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
-			NewOrExistingInfo.Size = Super.GetStructSize();
+			HierarchyLevels[Depth].push_back(*It);
+		}
 
-		int32 LastMemberEnd = 0x0;
-		int32 LowestOffset = INT_MAX;
+		UnresolvedChain.clear();
+	}
 
-		// Find member with the lowest offset
-		for (UEProperty Property : ObjAsStruct.GetProperties())
-		{
-			const int32 PropertyOffset = Property.GetOffset();
-			const int32 PropertySize = Property.GetSize();
+	/* Top-down: alignments, a struct is at least as aligned as its super */
+	auto InitAlignment = [&](int32 DenseIndex) -> void
+	{
+		const UEStruct ObjAsStruct = ObjectArray::GetByIndex<UEStruct>(DenseIndexManager::GetObjectIndex(DenseIndex, EDenseIndexType::Struct));
 
-			if (PropertyOffset < LowestOffset)
-				LowestOffset = PropertyOffset;
+		StructInfo& Info = StructInfos[DenseIndex];
+		MemberLayout& Layout = Layouts[DenseIndex];
 
-			if ((PropertyOffset + PropertySize) > LastMemberEnd)
-				LastMemberEnd = PropertyOffset + PropertySize;
+		// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
+		if (ObjAsStruct.HasType(InterfaceClass))
+		{
+			Info.Alignment = 0x1;
+			Info.bHasReusedTrailingPadding = false;
+			Info.bIsFinal = true;
+			Info.Size = 0x0;
+
+			Layout.bIsInterface = true;
+			return;
 		}
 
-		/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
-		NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
+		InitFromMembers(ObjAsStruct, Info, Layout);
 
-		if (!Super || ObjAsStruct.IsA(EClassCastFlags::Function))
-			continue;
+		const int32 SuperIndex = SuperIndices[DenseIndex];
 
-		/*
-		* Loop all super-structs and set their struct-size to the lowest offset we found. Sets this size on the direct Super and all higher *empty* supers
-		* 
-		* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
-		*/
-		for (UEStruct S = Super; S; S = S.GetSuper())
+		// We use the super classes' alignment, no need to explicitely set it
+		if (SuperIndex != -1 && StructInfos[SuperIndex].Alignment >= Info.Alignment)
 		{
-			auto It = StructInfoOverrides.find(S.GetIndex());
+			Info.bUseExplicitAlignment = false;
+			Info.Alignment = StructInfos[SuperIndex].Alignment;
+		}
+	};
+
+	/*
+	* Bottom-up: the compiler places members of a child in the trailing padding of its super. The size of the super is reduced to the lowest member-offset
+	* of its children. Offsets of children without members are passed on to the next higher super, until a super with members is reached.
+	*/
+	auto InitSizeAndIsFinal = [&](int32 DenseIndex) -> void
+	{
+		StructInfo& Info = StructInfos[DenseIndex];
+		MemberLayout& Layout = Layouts[DenseIndex];
+
+		if (Layout.bIsInterface)
+			return;
 
-			if (It == StructInfoOverrides.end())
-			{
-				std::cerr << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfoOverrides'! Exiting...\n\n\n" << std::endl;
-				Sleep(10000);
-				exit(1);
-			}
+		int32 LowestChildOffset = INT_MAX;
 
-			StructInfo& Info = It->second;
+		for (const int32 Child : Hierarchy.GetEdges(DenseIndex))
+		{
+			if (Layouts[Child].bIsInterface)
+				continue;
 
 			// Struct is not final, as it is another structs' super
 			Info.bIsFinal = false;
 
-			const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
-
-			// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
-			if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
-			{
-				if (Info.Size > LowestOffset)
-					Info.Size = LowestOffset;
+			if (Layouts[Child].LowestOffsetForSuper < LowestChildOffset)
+				LowestChildOffset = Layouts[Child].LowestOffsetForSuper;
+		}
 
-				Info.bHasReusedTrailingPadding = true;
-			}
+		// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
+		if (Align(Info.Size, Info.Alignment) > LowestChildOffset)
+		{
+			if (Info.Size > LowestChildOffset)
+				Info.Size = LowestChildOffset;
 
-			if (S.HasMembers())
-				break;
+			Info.bHasReusedTrailingPadding = true;
 		}
-	}
+
+		Layout.LowestOffsetForSuper = Layout.bHasMembers ? Layout.LowestOffset : min(Layout.LowestOffset, LowestChildOffset);
+	};
+
+	for (const std::vector<int32>& Level : HierarchyLevels)
+		std::for_each(std::execution::par, Level.begin(), Level.end(), InitAlignment);
+
+	for (auto It = HierarchyLevels.rbegin(); It != HierarchyLevels.rend(); ++It)
+		std::for_each(std::execution::par, It->begin(), It->end(), InitSizeAndIsFinal);
 }
 
 void StructManager::Init()
@@ -251,19 +299,21 @@ void StructManager::Init()
 
 	bIsInitialized = true;
 
-	StructInfoOverrides.reserve(0x2000);
+	StructInfos.resize(DenseIndexManager::GetNum(EDenseIndexType::Struct));
+	FunctionInfos.resize(DenseIndexManager::GetNum(EDenseIndexType::Function));
+	CyclicStructsAndPackages.resize(DenseIndexManager::GetNum(EDenseIndexType::Struct));
 
-	InitAlignmentsAndNames();
-	InitSizesAndIsFinal();
+	InitNames();
+	InitLayouts();
 
 	/* 
 	* The default class-alignment of 0x8 is only set for classes with a valid Super-class, because they inherit from UObject. 
 	* UObject however doesn't have a super, so this needs to be set manually.
 	*/
 	const UEObject UObjectClass = ObjectArray::FindClassFast("Object");
-	StructInfoOverrides.find(UObjectClass.GetIndex())->second.Alignment = sizeof(void*);
+	GetInfoRef(UObjectClass.GetIndex()).Alignment = sizeof(void*);
 
 	/* I still hate whoever decided to call "UStruct" "Ustruct" on some UE versions. */
 	if (const UEObject UStructClass = ObjectArray::FindClassFast("struct"))
-		StructInfoOverrides.find(UStructClass.GetIndex())->second.Name = UniqueNameTable.FindOrAdd(std::string("UStruct"), false).first;
+		GetInfoRef(UStructClass.GetIndex()).Name = UniqueNameTable.FindOrAdd(std::string("UStruct"), false).first;
 }
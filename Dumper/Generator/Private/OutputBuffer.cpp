@@ -0,0 +1,29 @@
+#include <fstream>
+
+#include "OutputBuffer.h"
+#include "FileManifest.h"
+
+
+bool OutputBuffer::WriteToFile(const std::filesystem::path& FilePath, bool bIsBinary) const
+{
+	const uint64 Hash = FileManifest::HashContent(Data);
+
+	/* Keep unchanged files, and their timestamps, from the previous run */
+	if (!FileManifest::NeedsWrite(FilePath, Hash))
+		return true;
+
+	std::ofstream File(FilePath, bIsBinary ? (std::ios::out | std::ios::binary) : std::ios::out);
+
+	if (!File.is_open())
+		return false;
+
+	File.write(Data.data(), static_cast<std::streamsize>(Data.size()));
+	File.close();
+
+	if (!File.good())
+		return false;
+
+	FileManifest::OnFileWritten(FilePath, Hash);
+
+	return true;
+}
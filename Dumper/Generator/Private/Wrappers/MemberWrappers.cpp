@@ -6,8 +6,8 @@ PropertyWrapper::PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, cons
 {
 }
 
-PropertyWrapper::PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop)
-    : Property(Prop), Name(MemberManager::GetNameCollisionInfo(Str->GetUnrealStruct(), Prop)), Struct(Str), bIsUnrealProperty(true)
+PropertyWrapper::PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop, NameInfo PropName)
+    : Property(Prop), Name(PropName), Struct(Str), bIsUnrealProperty(true)
 {
 }
 
@@ -165,8 +165,8 @@ FunctionWrapper::FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, cons
 {
 }
 
-FunctionWrapper::FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func)
-    : Function(Func), Name(Str ? MemberManager::GetNameCollisionInfo(Str->GetUnrealStruct(), Func) : NameInfo()), Struct(Str), bIsUnrealFunction(true)
+FunctionWrapper::FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func, NameInfo FuncName)
+    : Function(Func), Name(Str ? FuncName : NameInfo()), Struct(Str), bIsUnrealFunction(true)
 {
 }
 
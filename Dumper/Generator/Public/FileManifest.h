@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+#include <future>
+#include <mutex>
+
+#include "Unreal/Enums.h"
+
+
+/*
+* Tracks all files written through OutputBuffer::WriteToFile() across runs, so unchanged files don't have to be rewritten.
+*
+* For every file the manifest stores a hash of its content, its last write-time and the generator that wrote it. A file whose content didn't
+* change since the previous run, and which wasn't modified on disk, is left untouched and keeps its timestamp. Builds of the SDK then only
+* recompile what actually changed. Files written by a generator in the previous run, but not in the current one, are deleted once the
+* generator finished.
+*
+* Manifest file layout (text, one file per line):
+*
+* D7MANIFEST <Version>
+* <Hash as hex> <WriteTime> <Generator> <Path relative to the dumper folder>
+*/
+class FileManifest
+{
+private:
+	struct FileEntry
+	{
+		uint64 Hash;
+		int64 WriteTime;
+		std::string Owner;
+	};
+
+private:
+	static constexpr std::string_view ManifestHeader = "D7MANIFEST";
+
+	/* Increment on any change to the file layout */
+	static constexpr uint32 ManifestVersion = 0x1;
+
+private:
+	static inline std::mutex EntriesLock;
+
+	static inline std::filesystem::path DumperFolder;
+
+	/* Keys are generic paths, relative to the DumperFolder */
+	static inline std::unordered_map<std::string, FileEntry> PreviousEntries;
+	static inline std::unordered_map<std::string, FileEntry> CurrentEntries;
+
+	/* MainFolderName of the generator currently running */
+	static inline std::string CurrentOwner;
+
+	static inline std::vector<std::future<void>> PendingDeletions;
+
+private:
+	/* Returns an empty string for files outside of the DumperFolder, which aren't tracked */
+	static std::string GetKey(const std::filesystem::path& FilePath);
+
+	static int64 GetWriteTime(const std::filesystem::path& FilePath);
+
+	static void Load();
+	static void Save();
+
+public:
+	/* Loads the manifest of the previous run in this folder, if there is one */
+	static void Init(const std::filesystem::path& InDumperFolder);
+
+	static bool IsEnabled();
+
+	/* Whether there are files of a previous run to update. If not, existing folders need to be cleared instead to not leave stale files behind. */
+	static bool HasPreviousFiles();
+	static bool HasPreviousFiles(const std::string& Owner);
+
+	static void BeginGenerator(const std::string& Owner);
+
+	/* Deletes files written by the current generator in the previous run but not in this one, then saves the manifest */
+	static void EndGenerator();
+
+	/* Removes a file or folder on a background thread */
+	static void RemoveInBackground(std::filesystem::path Path);
+	static void WaitForPendingDeletions();
+
+public:
+	static uint64 HashContent(std::string_view Content);
+
+	/* Returns false if the file already exists with this content and wasn't modified since it was written. Thread-safe. */
+	static bool NeedsWrite(const std::filesystem::path& FilePath, uint64 Hash);
+
+	/* Thread-safe */
+	static void OnFileWritten(const std::filesystem::path& FilePath, uint64 Hash);
+};
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <filesystem>
-#include <fstream>
+#include <shared_mutex>
 
 #include "Managers/DependencyManager.h"
 #include "Managers/StructManager.h"
@@ -12,6 +12,7 @@
 #include "Managers/PackageManager.h"
 
 #include "HashStringTable.h"
+#include "OutputBuffer.h"
 #include "Generator.h"
 
 namespace fs = std::filesystem;
@@ -66,13 +67,30 @@ private:
         SdkHpp,
 
         DebugAssertions,
+
+        PrecompiledHeader,
+        UnityBuild,
+
+        ForwardDeclarations,
+
+        ClassNameTable,
     };
 
-private:
-    using StreamType = std::ofstream;
+    struct SourceFileInfo
+    {
+        /* Relative to the Subfolder */
+        std::string FileName;
+        size_t Size;
+    };
+
+    struct TypeStringEntry
+    {
+        std::string Type;
+        bool bIsUnknownProperty;
+    };
 
 public:
-    static inline PredefinedMemberLookupMapType PredefinedMembers;
+    static inline PredefinedMemberLookupTable PredefinedMembers;
 
     static inline std::string MainFolderName = "CppSDK";
     static inline std::string SubfolderName = "SDK";
@@ -80,31 +98,54 @@ public:
     static inline fs::path MainFolder;
     static inline fs::path Subfolder;
 
+private:
+    static inline std::shared_mutex TypeStringCacheLock;
+
+    /* Type-strings keyed by the structural signature of the property-type, see AppendTypeSignature(). Identical type-shapes recur very often. */
+    static inline std::unordered_map<std::string, TypeStringEntry> TypeStringCache;
+
+    /* Packages of the partial SDK, empty if the full SDK is generated. See InitPartialSDK(). */
+    static inline std::unordered_set<int32> PartialSDKPackages;
+
+    /* Packages of which only the '_fwd.hpp' file is required by the partial SDK */
+    static inline std::unordered_set<int32> PartialSDKForwardDeclaredPackages;
+
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
 private:
-    static std::string MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment);
-    static std::string MakeMemberStringWithoutName(const std::string& Type);
+    /* Member emission writes directly into the struct's buffer, names and comments are formatted in place instead of being built as temporary strings */
+    template<typename... ArgTypes>
+    static void WriteMember(OutputBuffer& Out, std::string_view Type, std::string_view Name, std::format_string<ArgTypes...> CommentFmt, ArgTypes&&... CommentArgs);
+    static void WriteMemberWithoutName(OutputBuffer& Out, std::string_view Type);
 
-    static std::string GenerateBytePadding(const int32 Offset, const int32 PadSize, std::string&& Reason);
-    static std::string GenerateBitPadding(uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string&& Reason);
+    static void WriteBytePadding(OutputBuffer& Out, const int32 Offset, const int32 PadSize, std::string_view Reason);
+    static void WriteBitPadding(OutputBuffer& Out, uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string_view Reason);
 
-    static std::string GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex = -1);
+    static void GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, OutputBuffer& StructFile, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex = -1);
     static FunctionInfo GenerateFunctionInfo(const FunctionWrapper& Func);
 
+    /* Whether the wrapper calls the function's 'ExecFunction' directly, see Settings::CppGenerator::bGenerateNativeFastPath. Only native functions without parameters, apart from the return-value, qualify. */
+    static bool CanCallNativeFunctionDirectly(const FunctionWrapper& Func);
+
     // return: In-header function declarations and inline functions
-    static std::string GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile);
-    static std::string GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile);
+    static std::string GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile, int32 FunctionTableIndex = -1);
+    /* Writes the function-table of a class into its functions file, see Settings::CppGenerator::bGenerateFunctionTables. Returns false if the class doesn't get one. */
+    static bool GenerateFunctionTable(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, OutputBuffer& FunctionFile);
+    static std::string GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile);
 
-    static void GenerateStruct(const StructWrapper& Struct, StreamType& StructFile, StreamType& FunctionFile, StreamType& ParamFile, StreamType& AssertionFile, int32 PackageIndex = -1, const std::string& StructNameOverride = std::string());
+    static void GenerateStruct(const StructWrapper& Struct, OutputBuffer& StructFile, OutputBuffer& FunctionFile, OutputBuffer& ParamFile, OutputBuffer& AssertionFile, int32 PackageIndex = -1, const std::string& StructNameOverride = std::string());
 
-    static void GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile);
+    static void GenerateEnum(const EnumWrapper& Enum, OutputBuffer& StructFile);
 
 private: /* utility functions */
     static std::string GetMemberTypeString(const PropertyWrapper& MemberWrapper, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false /* const USomeClass* Member; */);
     static std::string GetMemberTypeString(UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
-    static std::string GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1, bool* bOutIsUnknownProperty = nullptr);
+    /* Returns an interned string, valid until the next call to Generate(). Thread-safe. */
+    static std::string_view GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1, bool* bOutIsUnknownProperty = nullptr);
+
+    static void AppendTypeSignature(std::string& Signature, UEProperty Member, int32 PackageIndex);
+    static std::string MakeMemberTypeString(UEProperty Member, int32 PackageIndex, bool* bOutIsUnknownProperty);
 
     static std::string GetFunctionSignature(UEFunction Func);
 
@@ -119,18 +160,34 @@ private: /* utility functions */
     static std::unordered_map<std::string, UEProperty> GetUnknownProperties();
 
 private:
-    static void GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile);
+    static void GenerateEnumFwdDeclarations(OutputBuffer& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile);
+
+    /* Opaque declarations of all enums of this package, see Settings::CppGenerator::bGenerateForwardDeclarationHeaders */
+    static void GenerateForwardDeclarationFile(OutputBuffer& FwdFile, PackageInfoHandle Package);
+
+    /* Generates all files of a single package. Thread-safe, AssertionFile is only used if Settings::Debug::bGenerateAssertionFile is enabled. */
+    static void GeneratePackage(PackageInfoHandle Package, OutputBuffer& AssertionFile, std::vector<SourceFileInfo>& OutFunctionFiles);
+
+    /* Resolves Settings::Config::SDKRootSet to the packages of the partial SDK. CoreUObject and Engine are always generated, as Basic.cpp requires them. */
+    static void InitPartialSDK();
+    static bool ShouldGeneratePackage(int32 PackageIndex);
+
+    /* Writes the precompiled header and distributes the '_functions.cpp' files to unity files balanced by their size. Appends the unity files to OutCppFiles. */
+    static void GenerateUnityBuildFiles(const std::vector<SourceFileInfo>& FunctionFiles, std::vector<std::string>& OutCppFiles);
 
 private:
-    static void GenerateNameCollisionsInl(StreamType& NameCollisionsFile);
-    static void GeneratePropertyFixupFile(StreamType& PropertyFixup);
-    static void GenerateDebugAssertions(StreamType& AssertionStream);
-    static void WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment = "", const std::string& CustomIncludes = "");
-    static void WriteFileEnd(StreamType& File, EFileType Type);
+    static void GenerateNameCollisionsInl(OutputBuffer& NameCollisionsFile);
+    static void GeneratePropertyFixupFile(OutputBuffer& PropertyFixup);
+    static void GenerateDebugAssertions(OutputBuffer& AssertionStream);
+    static void WriteFileHead(OutputBuffer& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment = "", const std::string& CustomIncludes = "");
+    static void WriteFileEnd(OutputBuffer& File, EFileType Type);
+
+    static void GenerateSDKHeader(OutputBuffer& SdkHpp);
 
-    static void GenerateSDKHeader(StreamType& SdkHpp);
+    /* 'ClassNameTable.hpp', a perfect-hash table of the raw names of all generated classes to their 'StaticClass()'. See Settings::CppGenerator::bGenerateNameTables */
+    static void GenerateClassNameTable(OutputBuffer& TableFile, const std::vector<PackageInfoHandle>& Packages);
 
-    static void GenerateBasicFiles(StreamType& BasicH, StreamType& BasicCpp, StreamType& AssertionsFile);
+    static void GenerateBasicFiles(OutputBuffer& BasicH, OutputBuffer& BasicCpp, OutputBuffer& AssertionsFile);
 
     static void GenerateVTHookFile();
     static void GenerateVSProject(const std::vector<std::string>& AllHppFiles, const std::vector<std::string>& AllCppFiles);
@@ -141,14 +198,14 @@ private:
     *
     * See https://github.com/Fischsalat/UnrealContainers/blob/master/UnrealContainers/UnrealContainersNoAlloc.h 
     */
-    static void GenerateUnrealContainers(StreamType& UEContainersHeader);
+    static void GenerateUnrealContainers(OutputBuffer& UEContainersHeader);
 
     /*
     * Creates the UtfN.hpp file for the SDK.
     *
     * See https://github.com/Fischsalat/UTF-N
     */
-    static void GenerateUnicodeLib(StreamType& UnicodeLib);
+    static void GenerateUnicodeLib(OutputBuffer& UnicodeLib);
 
 public:
     static void Generate();
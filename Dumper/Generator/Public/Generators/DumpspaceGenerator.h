@@ -22,7 +22,7 @@ private:
     using StreamType = std::ofstream;
 
 public:
-    static inline PredefinedMemberLookupMapType PredefinedMembers;
+    static inline PredefinedMemberLookupTable PredefinedMembers;
 
     static inline std::string MainFolderName = "Dumpspace";
     static inline std::string SubfolderName = "";
@@ -5,7 +5,9 @@
 #include "Unreal/ObjectArray.h"
 #include "Managers/DependencyManager.h"
 #include "Managers/MemberManager.h"
+#include "Managers/IRManager.h"
 #include "HashStringTable.h"
+#include "FileManifest.h"
 
 
 namespace fs = std::filesystem;
@@ -17,7 +19,7 @@ concept GeneratorImplementation = requires(GeneratorType t)
 {
     /* Require static variables of type */
     GeneratorType::PredefinedMembers;
-    requires(std::same_as<decltype(GeneratorType::PredefinedMembers), PredefinedMemberLookupMapType>);
+    requires(std::same_as<decltype(GeneratorType::PredefinedMembers), PredefinedMemberLookupTable>);
 
     GeneratorType::MainFolderName;
     requires(std::same_as<decltype(GeneratorType::MainFolderName), std::string>);
@@ -52,7 +54,13 @@ public:
     static void InitEngineCore();
     static void InitInternal();
 
+    /* Loads the IR written by a previous dump instead of reading the game. Only generators consuming nothing but the IR can run afterwards. */
+    static bool InitFromIRFile(const fs::path& FilePath);
+
 private:
+    /* Moves the folder to "<Folder>_OLD", the previous "_OLD" folder is deleted in the background */
+    static void ClearFolder(const fs::path& Folder);
+
     static bool SetupDumperFolder();
 
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder);
@@ -62,6 +70,10 @@ public:
     template<GeneratorImplementation GeneratorType>
     static void Generate() 
     { 
+        /* The IR is only built once a generator reading it runs, a dump of just the C++ SDK doesn't copy every name into it */
+        if constexpr (Settings::Generator::bWriteIRFile || requires { requires GeneratorType::bUsesIR; })
+            IRManager::Init();
+
         if (DumperFolder.empty())
         {
             if (!SetupDumperFolder())
@@ -81,6 +93,9 @@ public:
                 bDumepdEditorOnlyMetadata = true;
                 DumpEditorOnlyMetadata(DumperFolder);
             }
+
+            if constexpr (Settings::Generator::bWriteIRFile)
+                IRManager::SaveToFile(DumperFolder / Settings::Generator::IRFileName);
         }
 
         if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder))
@@ -91,6 +106,10 @@ public:
 
         MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
 
+        FileManifest::BeginGenerator(GeneratorType::MainFolderName);
+
         GeneratorType::Generate();
+
+        FileManifest::EndGenerator();
     };
 };
@@ -2,15 +2,24 @@
 
 #include <iostream>
 #include <string>
+#include <unordered_set>
 
 #include "Unreal/ObjectArray.h"
 #include "PredefinedMembers.h"
+#include "OutputBuffer.h"
+#include "Managers/IRManager.h"
 
 
 class IDAMappingGenerator
 {
+private:
+    friend class IRGeneratorTest;
+
 public:
-    static inline PredefinedMemberLookupMapType PredefinedMembers;
+    /* Only reads the IR, see Generator::Generate() */
+    static constexpr bool bUsesIR = true;
+
+    static inline PredefinedMemberLookupTable PredefinedMembers;
 
     static inline std::string MainFolderName = "IDAMappings";
     static inline std::string SubfolderName = "";
@@ -19,29 +28,27 @@ public:
     static inline fs::path Subfolder;
 
 private:
-    using StreamType = std::ofstream;
-
-private:
-    template<typename InStreamType, typename T>
-    static void WriteToStream(InStreamType& InStream, T Value)
+    template<typename T>
+    static void WriteToStream(OutputBuffer& InStream, T Value)
     {
-        InStream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+        InStream.Write(&Value, sizeof(T));
     }
 
-    template<typename InStreamType, typename T>
-    static void WriteToStream(InStreamType& InStream, T* Value, int32 Size)
+    template<typename T>
+    static void WriteToStream(OutputBuffer& InStream, T* Value, int32 Size)
     {
-        InStream.write(reinterpret_cast<const char*>(Value), Size);
+        InStream.Write(Value, Size);
     }
 
 private:
     static std::string MangleFunctionName(const std::string& ClassName, const std::string& FunctionName);
 
 private:
-    static void WriteReadMe(StreamType& ReadMe);
+    static void WriteReadMe(OutputBuffer& ReadMe);
 
-    static void GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject);
-    static void GenerateClassFunctions(StreamType& IdmapFile, UEClass Class);
+    static void GenerateVTableName(OutputBuffer& IdmapFile, const IRStruct& Class);
+    /* 'NamedExecFunctions' are the offsets of exec-functions already written to the file, functions sharing one are only named once */
+    static void GenerateClassFunctions(OutputBuffer& IdmapFile, const SDKIR& IR, const IRStruct& Class, std::unordered_set<uint32>& NamedExecFunctions);
 
 public:
     static void Generate();
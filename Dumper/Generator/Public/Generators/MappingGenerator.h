@@ -1,10 +1,11 @@
 #pragma once
 
-#include <fstream>
+#include <unordered_map>
 
 #include "Unreal/ObjectArray.h"
-#include "Wrappers/MemberWrappers.h"
-#include "Wrappers/EnumWrapper.h"
+#include "PredefinedMembers.h"
+#include "OutputBuffer.h"
+#include "Managers/IRManager.h"
 
 
 /*
@@ -63,7 +64,7 @@
 class MappingGenerator
 {
 private:
-    using StreamType = std::ofstream;
+    friend class IRGeneratorTest;
 
 private:
     enum class EUsmapVersion : uint8
@@ -93,8 +94,14 @@ private:
 private:
     static inline uint64 NameCounter = 0x0;
 
+    /* Index of every name in the name-table, if 'bShouldCheckForDuplicatedNames' is enabled. Cleared with NameCounter for every file. */
+    static inline std::unordered_map<std::string, int32> NameIndices;
+
 public:
-    static inline PredefinedMemberLookupMapType PredefinedMembers;
+    /* Only reads the IR, see Generator::Generate() */
+    static constexpr bool bUsesIR = true;
+
+    static inline PredefinedMemberLookupTable PredefinedMembers;
 
     static inline std::string MainFolderName = "Mappings";
     static inline std::string SubfolderName = "";
@@ -103,32 +110,31 @@ public:
     static inline fs::path Subfolder;
 
 private:
-    template<typename InStreamType, typename T>
-    static void WriteToStream(InStreamType& InStream, T Value)
+    template<typename T>
+    static void WriteToStream(OutputBuffer& InStream, T Value)
     {
-        InStream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+        InStream.Write(&Value, sizeof(T));
     }
 
-    template<typename InStreamType>
-    static void WriteToStream(InStreamType& InStream, const std::stringstream& Data)
+    static void WriteToStream(OutputBuffer& InStream, const OutputBuffer& Data)
     {
-        InStream << Data.rdbuf();
+        InStream << Data.View();
     }
 
 private:
     /* Utility Functions */
-    static EMappingsTypeFlags GetMappingType(UEProperty Property);
-    static int32 AddNameToData(std::stringstream& NameTable, const std::string& Name);
+    static EMappingsTypeFlags GetMappingType(EClassCastFlags Flags);
+    static int32 AddNameToData(OutputBuffer& NameTable, const std::string& Name);
 
 private:
-    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable);
-    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index);
+    static void GeneratePropertyType(const SDKIR& IR, int32 TypeIndex, OutputBuffer& Data, OutputBuffer& NameTable);
+    static void GeneratePropertyInfo(const SDKIR& IR, const IRMember& Property, OutputBuffer& Data, OutputBuffer& NameTable, int32& Index);
 
-    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable);
-    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable);
+    static void GenerateStruct(const SDKIR& IR, const IRStruct& Struct, OutputBuffer& Data, OutputBuffer& NameTable);
+    static void GenerateEnum(const SDKIR& IR, const IREnum& Enum, OutputBuffer& Data, OutputBuffer& NameTable);
 
-    static std::stringstream GenerateFileData();
-    static void GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data);
+    static OutputBuffer GenerateFileData(const SDKIR& IR);
+    static void GenerateFileHeader(OutputBuffer& InUsmap, const OutputBuffer& Data);
 
 public:
     static void Generate();
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+#include "Unreal/ObjectArray.h"
+#include "PredefinedMembers.h"
+#include "OutputBuffer.h"
+#include "Managers/IRManager.h"
+
+
+/*
+* Generates a lightweight SDK only containing constexpr offsets, sizes and alignments of all structs and classes, one header per package.
+*
+* Every struct becomes a namespace of constants, 'SDKOffsets::AActor::RootComponent'. Exec-functions of native functions are listed in a nested
+* 'Functions' namespace. The headers have no includes besides Basic.hpp and no dependencies between each other, so they compile in a fraction
+* of the time of the full C++ SDK. Built from the same IR as the other generators, the values always match the C++ SDK of the same run.
+*/
+class OffsetsGenerator
+{
+public:
+    /* Only reads the IR, see Generator::Generate() */
+    static constexpr bool bUsesIR = true;
+
+    static inline PredefinedMemberLookupTable PredefinedMembers;
+
+    static inline std::string MainFolderName = "OffsetsSDK";
+    static inline std::string SubfolderName = "Offsets";
+
+    static inline fs::path MainFolder;
+    static inline fs::path Subfolder;
+
+private:
+    static void WriteFileHead(OutputBuffer& File, const std::string& FileComment);
+
+    static void GenerateBasicFile(OutputBuffer& BasicFile);
+
+    /* Offsets of members the dumper finds itself, which aren't reflected (eg. UObject::Class) */
+    static void GeneratePredefinedMembers(OutputBuffer& PackageFile, const IRStruct& Struct);
+
+    static void GenerateStruct(OutputBuffer& PackageFile, const SDKIR& IR, const IRStruct& Struct);
+    static void GeneratePackage(OutputBuffer& PackageFile, const SDKIR& IR, const IRPackage& Package);
+
+public:
+    static void Generate();
+
+    /* Always empty, predefined members are written directly from the offsets found by the dumper */
+    static void InitPredefinedMembers() { }
+    static void InitPredefinedFunctions() { }
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Unreal/ObjectArray.h"
+#include "PredefinedMembers.h"
+#include "OutputBuffer.h"
+#include "Managers/IRManager.h"
+
+
+/*
+* Generates an SDK for tools reading the game from outside of its process, from the same IR as the other generators.
+*
+* Structs and classes are generated as views over a snapshot of the object's memory. The snapshot is read through a user-provided
+* 'IMemoryReader' with a single read of the struct's size, member accessors then only copy from it. Names are decoded from cached
+* copies of the FNamePool blocks. Functions are not generated, they can't be called from outside of the process.
+*/
+class RemoteSDKGenerator
+{
+public:
+    /* Only reads the IR, see Generator::Generate() */
+    static constexpr bool bUsesIR = true;
+
+    static inline PredefinedMemberLookupTable PredefinedMembers;
+
+    static inline std::string MainFolderName = "RemoteSDK";
+    static inline std::string SubfolderName = "";
+
+    static inline fs::path MainFolder;
+    static inline fs::path Subfolder;
+
+private:
+    /* Dense package-index of every enum, IREnum doesn't store it */
+    static inline std::vector<int32> EnumPackageIndices;
+
+private:
+    static std::string GetStructName(const SDKIR& IR, const IRStruct& Struct);
+    static std::string GetEnumName(const SDKIR& IR, const IREnum& Enum);
+
+    /* Returns the type of the accessor, or an empty string if the property-type isn't supported */
+    static std::string GetAccessorType(const SDKIR& IR, int32 TypeIndex, int32 Size);
+
+    /* Index of the struct referenced by a StructProperty, -1 if it can't be resolved */
+    static int32 GetReferencedStructIndex(const SDKIR& IR, int32 TypeIndex);
+
+    /* Whether the type, or the inner-type of an array, references a struct or enum that isn't part of the IR */
+    static bool HasUnresolvedReference(const SDKIR& IR, int32 TypeIndex);
+
+    /* Index of UClass, looked up in the package of UObject. -1 if it doesn't exist. */
+    static int32 FindClassStructIndex(const SDKIR& IR, const IRStruct& ObjectStruct);
+
+    /* Structs in an order in which supers and structs used by value are defined first */
+    static std::vector<int32> GetSortedStructs(const SDKIR& IR);
+
+private:
+    static void GenerateBasicFile(OutputBuffer& BasicFile);
+
+    /* Standalone tests of the runtime in 'RemoteBasic.hpp', reading synthetic objects through an FBufferReader */
+    static void GenerateTestFile(OutputBuffer& TestFile);
+
+    static void GenerateEnum(OutputBuffer& SdkFile, const SDKIR& IR, const IREnum& Enum);
+    static void GenerateStruct(OutputBuffer& SdkFile, const SDKIR& IR, const IRStruct& Struct);
+
+public:
+    static void Generate();
+
+    /* Always empty, members of UObject are added to its view directly */
+    static void InitPredefinedMembers() { }
+    static void InitPredefinedFunctions() { }
+};
@@ -1,4 +1,6 @@
 #pragma once
+#include <span>
+
 #include "Unreal/ObjectArray.h"
 #include "HashStringTable.h"
 
@@ -90,14 +92,6 @@ public:
 	std::string DebugStringify() const;
 };
 
-namespace KeyFunctions
-{
-	/* Make a unique key from UEProperty/UEFunction for NameTranslation */
-	uint64 GetKeyForCollisionInfo(UEStruct Super, UEProperty Member);
-	uint64 GetKeyForCollisionInfo(UEStruct Super, UEFunction Function);
-}
-
-
 class CollisionManager
 {
 private:
@@ -109,18 +103,25 @@ private:
 public:
 	using NameContainer = std::vector<NameInfo>;
 
-	using NameInfoMapType = std::unordered_map<uint64, NameContainer>;
-	using TranslationMapType = std::unordered_map<uint64, uint64>;
+private:
+	struct NameSlice
+	{
+		int32 Offset;
+		int32 NumNames;
+	};
 
 private:
 	/* Nametable used for storing the string-names of member-/function-names contained by NameInfos */
 	HashStringTable MemberNames;
 
-	/* Member-names and name-collision info*/
-	CollisionManager::NameInfoMapType NameInfos;
+	/* Member-names and name-collision info of all structs and functions. Every struct/function owns one contiguous slice of it. */
+	NameContainer NameInfos;
+
+	/* Slices of NameInfos, indexed by the dense struct-index */
+	std::vector<NameSlice> NameSlices;
 
-	/* Map to translation from UEProperty/UEFunction to Index in NameContainer */
-	CollisionManager::TranslationMapType TranslationMap;
+	/* Translates an object-index to the dense index of the structs' slice in NameSlices, -1 if the struct wasn't added yet */
+	std::vector<int32> SliceIndices;
 
 	/* Names reserved for predefined members or local variables in function-bodies. Eg. "Class", "Parms", etc. */
 	NameContainer ClassReservedNames;
@@ -129,8 +130,16 @@ private:
 	NameContainer ReservedNames;
 
 private:
-	/* Returns index of NameInfo inside of the NameContainer it was added to */
-	uint64 AddNameToContainer(NameContainer& StructNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct, UEFunction Func = nullptr);
+	/* Adds the NameInfo to StructNames, or to FuncParamNames if CurrentType is ECollisionType::ParameterName */
+	void AddNameToContainer(NameContainer& StructNames, NameContainer* FuncParamNames, UEStruct Struct, std::pair<HashStringTableIndex, bool>&& NamePair, ECollisionType CurrentType, bool bIsStruct);
+
+	/* Copies Names into NameInfos and assigns the new slice to the object at ObjectIndex */
+	void AddNameSlice(int32 ObjectIndex, const NameContainer& Names);
+
+	inline bool HasNameSlice(int32 ObjectIndex) const
+	{
+		return ObjectIndex < SliceIndices.size() && SliceIndices[ObjectIndex] != -1;
+	}
 
 public:
 	/* For external use by 'MemberManager::InitReservedNames()' */
@@ -141,22 +150,28 @@ public:
 	std::string StringifyName(UEStruct Struct, NameInfo Info);
 
 public:
-	template<typename UEType>
-	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member)
+	/*
+	* Returns the NameInfos of all members of this struct, in field order.
+	*
+	* Index 'i' is the i-th property of 'Struct.GetProperties()', index 'NumProperties + i' the i-th function of 'Struct.GetFunctions()'.
+	* For functions the slice contains the names of their parameters.
+	*/
+	inline std::span<const NameInfo> GetNameCollisionInfos(UEStruct Struct) const
 	{
-		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+		const NameSlice& Slice = NameSlices[SliceIndices.at(Struct.GetIndex())];
 
-		return InfosForStruct.at(NameInfoIndex);
+		return std::span<const NameInfo>(NameInfos.data() + Slice.Offset, Slice.NumNames);
 	}
 
-private:
-	inline NameInfo& GetNameCollisionInfoRefUnchecked(UEStruct Struct, UEProperty Member)
+	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, int32 MemberIndex) const
 	{
-		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+		return NameInfos[NameSlices[SliceIndices.at(Struct.GetIndex())].Offset + MemberIndex];
+	}
 
-		return InfosForStruct.at(NameInfoIndex);
+private:
+	inline NameInfo& GetNameCollisionInfoRefUnchecked(UEStruct Struct, int32 MemberIndex)
+	{
+		return NameInfos[NameSlices[SliceIndices.at(Struct.GetIndex())].Offset + MemberIndex];
 	}
 };
 
@@ -170,7 +185,17 @@ public:
 	{
 		const auto [Index, _] = Collisions.MemberNames.FindOrAdd(NameToReplaceWith);
 
-		auto& NameInfo = Collisions.GetNameCollisionInfoRefUnchecked(Struct, Member);
+		int32 MemberIndex = 0x0;
+
+		for (UEProperty Property : Struct.GetProperties())
+		{
+			if (Property.GetAddress() == Member.GetAddress())
+				break;
+
+			MemberIndex++;
+		}
+
+		auto& NameInfo = Collisions.GetNameCollisionInfoRefUnchecked(Struct, MemberIndex);
 
 		NameInfo.CollisionData = 0;
 		NameInfo.Name = Index;
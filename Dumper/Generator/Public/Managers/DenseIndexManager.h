@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Unreal/Enums.h"
+
+
+enum class EDenseIndexType : uint8
+{
+	Struct,
+	Function,
+	Enum,
+	Package,
+
+	Num,
+	None = Num,
+};
+
+/*
+* Assigns dense, zero-based indices to all structs/classes, functions, enums and packages (containing structs or enums) in GObjects.
+*
+* Every type has its own index-space. Per-entity tables of the managers are std::vectors indexed by those dense indices, instead of
+* maps keyed by the sparse GObjects-index. Dense indices follow the order of the objects in GObjects.
+*
+* Init() is the only full sweep over GObjects during manager initialization, all managers are initialized from the resulting buckets.
+*/
+class DenseIndexManager
+{
+public:
+	using IndexListType = std::vector<int32>;
+
+private:
+	/* Dense index of every object in GObjects, -1 for untracked objects */
+	static inline std::vector<int32> DenseIndices;
+
+	/* Type of the index-space the dense index of an object belongs to */
+	static inline std::vector<EDenseIndexType> IndexTypes;
+
+	/* GObjects-indices of all objects, indexed by [Type][DenseIndex] */
+	static inline std::array<IndexListType, static_cast<size_t>(EDenseIndexType::Num)> ObjectIndices;
+
+	static inline bool bIsInitialized = false;
+
+private:
+	static void AddObject(int32 ObjectIndex, EDenseIndexType Type);
+
+public:
+	static void Init();
+
+public:
+	static inline int32 GetNum(EDenseIndexType Type)
+	{
+		return static_cast<int32>(ObjectIndices[static_cast<size_t>(Type)].size());
+	}
+
+	static inline EDenseIndexType GetType(int32 ObjectIndex)
+	{
+		if (ObjectIndex < 0 || ObjectIndex >= IndexTypes.size())
+			return EDenseIndexType::None;
+
+		return IndexTypes[ObjectIndex];
+	}
+
+	/* Returns the dense index of the object, or -1 if the object isn't of the requested type */
+	static inline int32 GetDenseIndex(int32 ObjectIndex, EDenseIndexType Type)
+	{
+		if (GetType(ObjectIndex) != Type)
+			return -1;
+
+		return DenseIndices[ObjectIndex];
+	}
+
+	static inline int32 GetObjectIndex(int32 DenseIndex, EDenseIndexType Type)
+	{
+		return ObjectIndices[static_cast<size_t>(Type)][DenseIndex];
+	}
+
+	static inline const IndexListType& GetObjectIndices(EDenseIndexType Type)
+	{
+		return ObjectIndices[static_cast<size_t>(Type)];
+	}
+
+	/* Calls 'Callback(ObjectIndex, Type)' for all objects of either type, merged back into the order of GObjects */
+	template<typename CallbackType>
+	static inline void ForEachObjectInOrder(EDenseIndexType FirstType, EDenseIndexType SecondType, CallbackType&& Callback)
+	{
+		const IndexListType& First = GetObjectIndices(FirstType);
+		const IndexListType& Second = GetObjectIndices(SecondType);
+
+		size_t FirstPos = 0x0;
+		size_t SecondPos = 0x0;
+
+		while (FirstPos < First.size() || SecondPos < Second.size())
+		{
+			if (SecondPos >= Second.size() || (FirstPos < First.size() && First[FirstPos] < Second[SecondPos]))
+			{
+				Callback(First[FirstPos++], FirstType);
+			}
+			else
+			{
+				Callback(Second[SecondPos++], SecondType);
+			}
+		}
+	}
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <span>
+
+#include "Unreal/Enums.h"
+
+
+/*
+* Immutable directed graph over dense node-indices [0, NumNodes), stored as compressed sparse rows (CSR).
+*
+* Edges are added with AddEdge() and keep their insertion order per node. After Finalize() the graph can no longer
+* be modified and its strongly connected components (SCCs) are available, computed in a single O(V + E) pass.
+*/
+class DependencyGraph
+{
+private:
+	/* Edges added before Finalize(), in insertion order */
+	std::vector<std::pair<int32, int32>> PendingEdges;
+
+	/* Targets of the edges going out of node N are Edges[EdgeOffsets[N]] to Edges[EdgeOffsets[N + 1] - 1] */
+	std::vector<int32> EdgeOffsets;
+	std::vector<int32> Edges;
+
+	/* Index of the SCC each node belongs to. Components are numbered in reverse topological order (dependencies first). */
+	std::vector<int32> ComponentIndices;
+
+	/* Whether a component contains a cycle, that is more than one node or a node depending on itself */
+	std::vector<bool> CyclicComponents;
+
+	int32 NumNodes = 0x0;
+	int32 NumCyclicComponents = 0x0;
+
+	bool bIsFinalized = false;
+
+public:
+	DependencyGraph() = default;
+
+	DependencyGraph(int32 InNumNodes);
+
+private:
+	void InitEdges();
+	void InitComponents();
+
+public:
+	void AddEdge(int32 From, int32 To);
+
+	/* Builds the CSR arrays and computes the SCCs. No edges may be added afterwards. */
+	void Finalize();
+
+public:
+	inline int32 GetNumNodes() const { return NumNodes; }
+	inline int32 GetNumEdges() const { return static_cast<int32>(Edges.size()); }
+	inline int32 GetNumComponents() const { return static_cast<int32>(CyclicComponents.size()); }
+
+	inline bool IsFinalized() const { return bIsFinalized; }
+
+	inline std::span<const int32> GetEdges(int32 Node) const
+	{
+		return std::span<const int32>(Edges.data() + EdgeOffsets[Node], Edges.data() + EdgeOffsets[Node + 1]);
+	}
+
+	inline int32 GetComponentIndex(int32 Node) const { return ComponentIndices[Node]; }
+
+	inline bool IsNodeInCycle(int32 Node) const { return CyclicComponents[ComponentIndices[Node]]; }
+
+	/* Whether the edge From -> To can be part of a cycle, which requires both nodes to be in the same cyclic SCC */
+	inline bool IsEdgeInCycle(int32 From, int32 To) const
+	{
+		return ComponentIndices[From] == ComponentIndices[To] && CyclicComponents[ComponentIndices[From]];
+	}
+
+	inline bool HasCycles() const { return NumCyclicComponents > 0x0; }
+};
@@ -7,6 +7,7 @@
 #include <functional>
 
 #include "Unreal/Enums.h"
+#include "Managers/DependencyGraph.h"
 
 
 class DependencyManager
@@ -15,21 +16,19 @@ public:
 	using OnVisitCallbackType = std::function<void(int32 Index)>;
 
 private:
-	struct IndexDependencyInfo
-	{
-		/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-		mutable uint64 IterationHitCounter = 0x0;
+	/* List of Objects and their Dependencies, only used until Finalize() is called */
+	std::unordered_map<int32, std::unordered_set<int32>> AllDependencies;
 
-		/* Indices of Objects required by this Object */
-		std::unordered_set<int32> DependencyIndices;
-	};
+	/* Object-indices of all nodes, in the order they were stored in AllDependencies */
+	std::vector<int32> Nodes;
 
-private:
-	/* List of Objects and their Dependencies */
-	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
+	/* Translates an object-index to an index into Nodes */
+	std::unordered_map<int32, int32> NodeIndices;
+
+	/* Dependencies between the elements of Nodes */
+	DependencyGraph Graph;
 
-	/* Count to track how often the Dependency-List was iterated. Allows for up to 2^64 iterations of this list. */
-	mutable uint64 CurrentIterationHitCount = 0x0;
+	bool bIsFinalized = false;
 
 public:
 	DependencyManager() = default;
@@ -37,7 +36,7 @@ public:
 	DependencyManager(int32 ObjectToTrack);
 
 private:
-	void VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const;
+	void VisitNodeAndDependencies(int32 Node, std::vector<bool>& VisitedNodes, std::vector<std::pair<int32, int32>>& Stack, const OnVisitCallbackType& Callback) const;
 
 public:
 	void SetExists(const int32 DepedantIdx);
@@ -46,14 +45,11 @@ public:
 
 	void SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies);
 
+	/* Converts the dependencies to a compact graph. Must be called before visiting nodes, no dependencies may be added afterwards. */
+	void Finalize();
+
 	size_t GetNumEntries() const;
 
 	void VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const;
 	void VisitAllNodesWithCallback(OnVisitCallbackType Callback) const;
-
-public:
-	const auto DEBUG_DependencyMap() const
-	{
-		return AllDependencies;
-	}
 };
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <span>
+
 #include "CollisionManager.h"
+#include "DenseIndexManager.h"
 
 
 class EnumInfoHandle;
@@ -42,26 +45,24 @@ private:
 	/* Wether an occurence of this enum was found, if not guess the type by the enums' max value */
 	bool bWasInstanceFound = false;
 
-	/* Whether this enums' size was initialized before */
-	bool bWasEnumSizeInitialized = false;
-
-	/* Infos on all members and if there are any collisions between member-names */
-	std::vector<EnumCollisionInfo> MemberInfos;
+	/* Range of the infos on all members, and if there are any collisions between member-names, in EnumManager::EnumMembers */
+	int32 MembersOffset = 0x0;
+	int32 NumMembers = 0x0;
 };
 
 struct CollisionInfoIterator
 {
 private:
-	const std::vector<EnumCollisionInfo>& CollisionInfos;
+	std::span<const EnumCollisionInfo> CollisionInfos;
 
 public:
-	CollisionInfoIterator(const std::vector<EnumCollisionInfo>& Infos)
+	CollisionInfoIterator(std::span<const EnumCollisionInfo> Infos)
 		: CollisionInfos(Infos)
 	{
 	}
 
 public:
-	auto begin() const { return CollisionInfos.cbegin(); }
+	auto begin() const { return CollisionInfos.begin(); }
 	auto end() const { return CollisionInfos.end(); }
 };
 
@@ -91,15 +92,18 @@ private:
 	friend class EnumInfoHandle;
 
 public:
-	using OverrideMaptType = std::unordered_map<int32 /* EnumIndex */, EnumInfo>;
+	using EnumInfoListType = std::vector<EnumInfo>;
 	using IllegalNameContaierType = std::vector<HashStringTableIndex>;
 
 private:
 	/* NameTable containing names of all enums as well as information on name-collisions */
 	static inline HashStringTable UniqueEnumNameTable;
 
-	/* Map containing infos on all enums. Implemented due to information missing in the Unreal's reflection system (EnumSize). */
-	static inline OverrideMaptType EnumInfoOverrides;
+	/* Infos on all enums, indexed by their dense enum-index. Implemented due to information missing in the Unreal's reflection system (EnumSize). */
+	static inline EnumInfoListType EnumInfos;
+
+	/* Members of all enums, decoded once from UEnum::Names. Every enum owns one contiguous range, see EnumInfo::MembersOffset. */
+	static inline std::vector<EnumCollisionInfo> EnumMembers;
 
 	/* NameTable containing names of all enum-values as well as information on name-collisions */
 	static inline HashStringTable UniqueEnumValueNames;
@@ -110,6 +114,7 @@ private:
 	static inline bool bIsInitialized = false;
 
 private:
+	static void InitUnderlyingSizesFromProperties();
 	static void InitInternal();
 	static void InitIllegalNames();
 
@@ -127,10 +132,16 @@ private:
 		return UniqueEnumValueNames[Info.MemberName];
 	}
 
+	static inline std::span<const EnumCollisionInfo> GetMembers(const EnumInfo& Info)
+	{
+		return std::span<const EnumCollisionInfo>(EnumMembers.data() + Info.MembersOffset, Info.NumMembers);
+	}
+
 public:
-	static inline const OverrideMaptType& GetEnumInfos()
+	/* Use DenseIndexManager::GetObjectIndex() to get the index of the enum. */
+	static inline const EnumInfoListType& GetEnumInfos()
 	{
-		return EnumInfoOverrides;
+		return EnumInfos;
 	}
 
 	static inline bool IsEnumNameUnique(const EnumInfo& Info)
@@ -143,7 +154,7 @@ public:
 		if (!Enum)
 			return {};
 
-		return EnumInfoOverrides.at(Enum.GetIndex());
+		return EnumInfos.at(DenseIndexManager::GetDenseIndex(Enum.GetIndex(), EDenseIndexType::Enum));
 	}
 };
 
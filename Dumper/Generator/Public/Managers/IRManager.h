@@ -0,0 +1,396 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <span>
+#include <filesystem>
+#include <cstddef>
+#include <type_traits>
+
+#include "Unreal/Enums.h"
+
+
+class UEProperty;
+class MemberManager;
+
+/*
+* Immutable intermediate representation (IR) of the SDK.
+*
+* Built once by IRManager::Init(), after all other managers were initialized. Contains all information the generators need, with names, name-collisions,
+* sizes and ordering already resolved. Generators consuming the IR don't read game memory, which makes them safe to run in parallel and allows
+* feeding them a synthetic SDKIR.
+*
+* Structs, functions, enums and packages are indexed by their dense index (see DenseIndexManager). All ranges refer to the flat arrays in SDKIR.
+*/
+
+/* Type of a property. Nested types, like the inner type of an array, are referenced by their index in SDKIR::PropertyTypes. */
+struct IRPropertyType
+{
+	/* Cast-flags of the class of this property */
+	EClassCastFlags CastFlags = EClassCastFlags::None;
+
+	/* Dense struct-index of the struct of a StructProperty, -1 otherwise */
+	int32 ReferencedStructIndex = -1;
+
+	/* Dense enum-index of the enum of an EnumProperty/ByteProperty, -1 otherwise */
+	int32 ReferencedEnumIndex = -1;
+
+	/* EnumProperty: [UnderlayingType], ArrayProperty/SetProperty/OptionalProperty: [ElementType], MapProperty: [KeyType, ValueType]. -1 if there's no inner type. */
+	int32 InnerTypes[2] = { -1, -1 };
+};
+
+/* Member of a struct, or parameter of a function */
+struct IRMember
+{
+	std::string RawName;
+	std::string UniqueName;
+
+	int32 Offset = 0x0;
+	int32 Size = 0x0;
+	int32 ArrayDim = 0x1;
+
+	EPropertyFlags PropertyFlags = EPropertyFlags::None;
+
+	bool bIsBitField = false;
+	uint8 BitIndex = 0x0;
+	uint8 FieldMask = 0xFF;
+
+	/* Index into SDKIR::PropertyTypes, -1 for unknown types */
+	int32 TypeIndex = -1;
+};
+
+struct IRFunction
+{
+	std::string RawName;
+	std::string Name;
+	std::string UniqueName;
+
+	/* Dense struct-index of the class this function belongs to, -1 for functions outside of classes (eg. delegate signatures) */
+	int32 OuterIndex = -1;
+
+	EFunctionFlags FunctionFlags = EFunctionFlags::None;
+
+	/* Offset of the exec-function from the image-base, 0 for non-native functions */
+	uint32 ExecFunctionOffset = 0x0;
+
+	int32 ParamStructSize = 0x0;
+
+	/* Parameters in SDKIR::Members */
+	int32 ParamsOffset = 0x0;
+	int32 NumParams = 0x0;
+};
+
+struct IRStruct
+{
+	std::string RawName;
+	std::string CppName;
+	std::string UniqueName;
+	bool bIsUniqueName = true;
+
+	/* Dense package-index */
+	int32 PackageIndex = -1;
+
+	/* Dense struct-index of the super-struct, -1 if there's none */
+	int32 SuperIndex = -1;
+
+	int32 Size = 0x0;
+	int32 Alignment = 0x1;
+
+	bool bIsClass = false;
+	bool bIsFinal = false;
+
+	/* Offset of the VTable from the image-base, 0 if this isn't a class or the class doesn't override the VTable of its super */
+	uint32 VftOffset = 0x0;
+
+	/* Members in SDKIR::Members, sorted by offset */
+	int32 MembersOffset = 0x0;
+	int32 NumMembers = 0x0;
+
+	/* Dense function-indices in SDKIR::FunctionIndices, in the order they are declared in the SDK */
+	int32 FunctionsOffset = 0x0;
+	int32 NumFunctions = 0x0;
+};
+
+struct IREnumMember
+{
+	std::string UniqueName;
+	uint64 Value = 0x0;
+};
+
+struct IREnum
+{
+	std::string RawName;
+	std::string UniqueName;
+	bool bIsUniqueName = true;
+
+	uint8 UnderlyingTypeSize = 0x1;
+
+	/* Members in SDKIR::EnumMembers */
+	int32 MembersOffset = 0x0;
+	int32 NumMembers = 0x0;
+};
+
+struct IRPackage
+{
+	std::string Name;
+
+	bool bIsEmpty = true;
+
+	/* Dense enum-indices */
+	std::vector<int32> Enums;
+
+	/* Dense struct-indices, sorted so that dependencies come first */
+	std::vector<int32> SortedStructs;
+	std::vector<int32> SortedClasses;
+};
+
+struct SDKIR
+{
+	std::vector<IRPackage> Packages;
+	std::vector<IRStruct> Structs;
+	std::vector<IRFunction> Functions;
+	std::vector<IREnum> Enums;
+
+	std::vector<IRMember> Members;
+	std::vector<IRPropertyType> PropertyTypes;
+	std::vector<IREnumMember> EnumMembers;
+	std::vector<int32> FunctionIndices;
+
+	/* Name and version of the game, only set for an IR loaded by IRManager::LoadFromFile() */
+	std::string GameName;
+	std::string GameVersion;
+
+	inline std::span<const IRMember> GetMembers(const IRStruct& Struct) const
+	{
+		return std::span<const IRMember>(Members.data() + Struct.MembersOffset, Struct.NumMembers);
+	}
+
+	inline std::span<const IRMember> GetParams(const IRFunction& Function) const
+	{
+		return std::span<const IRMember>(Members.data() + Function.ParamsOffset, Function.NumParams);
+	}
+
+	inline std::span<const int32> GetFunctionIndices(const IRStruct& Struct) const
+	{
+		return std::span<const int32>(FunctionIndices.data() + Struct.FunctionsOffset, Struct.NumFunctions);
+	}
+
+	inline std::span<const IREnumMember> GetMembers(const IREnum& Enum) const
+	{
+		return std::span<const IREnumMember>(EnumMembers.data() + Enum.MembersOffset, Enum.NumMembers);
+	}
+
+	/* Returns nullptr for unknown types (TypeIndex == -1) */
+	inline const IRPropertyType* GetPropertyType(int32 TypeIndex) const
+	{
+		return TypeIndex >= 0 ? &PropertyTypes[TypeIndex] : nullptr;
+	}
+
+	/* Returns nullptr if the type doesn't reference a struct */
+	inline const IRStruct* GetReferencedStruct(const IRPropertyType& Type) const
+	{
+		return Type.ReferencedStructIndex >= 0 ? &Structs[Type.ReferencedStructIndex] : nullptr;
+	}
+
+	/* Returns nullptr if the type doesn't reference an enum */
+	inline const IREnum* GetReferencedEnum(const IRPropertyType& Type) const
+	{
+		return Type.ReferencedEnumIndex >= 0 ? &Enums[Type.ReferencedEnumIndex] : nullptr;
+	}
+
+	/* Returns nullptr if the struct has no super */
+	inline const IRStruct* GetSuper(const IRStruct& Struct) const
+	{
+		return Struct.SuperIndex >= 0 ? &Structs[Struct.SuperIndex] : nullptr;
+	}
+};
+
+/*
+* Binary file format of a serialized SDKIR, written by IRManager::SaveToFile().
+*
+* The file consists of a Header followed by tightly packed arrays of the records below, in the order of the counts in the Header. Every array starts at
+* an 8-byte aligned offset. Strings are stored once in a trailing string-pool and referenced by offset and length, indices are the same as in SDKIR.
+* All records are trivially copyable, the file can be memory-mapped and read in place.
+*
+* Header;
+* Package  Packages[NumPackages];
+* Struct   Structs[NumStructs];
+* Function Functions[NumFunctions];
+* Enum     Enums[NumEnums];
+* Member   Members[NumMembers];
+* PropType PropertyTypes[NumPropertyTypes];
+* EnumMember EnumMembers[NumEnumMembers];
+* int32    FunctionIndices[NumFunctionIndices];
+* int32    PackageIndices[NumPackageIndices];      // IRPackage::Enums, SortedStructs and SortedClasses of all packages
+* char     StringPool[StringPoolSize];
+*/
+namespace IRFile
+{
+	/* 'D7IR' */
+	constexpr uint32 Magic = 0x52493744;
+
+	/* Increment on any change to the records below */
+	constexpr uint32 Version = 0x3;
+
+	struct StringRef
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	struct Header
+	{
+		uint32 Magic;
+		uint32 Version;
+
+		uint32 NumPackages;
+		uint32 NumStructs;
+		uint32 NumFunctions;
+		uint32 NumEnums;
+		uint32 NumMembers;
+		uint32 NumPropertyTypes;
+		uint32 NumEnumMembers;
+		uint32 NumFunctionIndices;
+		uint32 NumPackageIndices;
+		uint32 StringPoolSize;
+
+		/* Settings::Generator::GameName and GameVersion of the dump that wrote the file */
+		StringRef GameName;
+		StringRef GameVersion;
+	};
+
+	struct Package
+	{
+		StringRef Name;
+		int32 EnumsOffset;
+		int32 NumEnums;
+		int32 StructsOffset;
+		int32 NumStructs;
+		int32 ClassesOffset;
+		int32 NumClasses;
+		uint32 bIsEmpty;
+	};
+
+	struct Struct
+	{
+		StringRef RawName;
+		StringRef CppName;
+		StringRef UniqueName;
+		int32 PackageIndex;
+		int32 SuperIndex;
+		int32 Size;
+		int32 Alignment;
+		uint32 VftOffset;
+		int32 MembersOffset;
+		int32 NumMembers;
+		int32 FunctionsOffset;
+		int32 NumFunctions;
+		uint8 bIsUniqueName;
+		uint8 bIsClass;
+		uint8 bIsFinal;
+		uint8 Pad_0[0x1];
+	};
+
+	struct Function
+	{
+		StringRef RawName;
+		StringRef Name;
+		StringRef UniqueName;
+		int32 OuterIndex;
+		uint32 FunctionFlags;
+		uint32 ExecFunctionOffset;
+		int32 ParamStructSize;
+		int32 ParamsOffset;
+		int32 NumParams;
+	};
+
+	struct Enum
+	{
+		StringRef RawName;
+		StringRef UniqueName;
+		int32 MembersOffset;
+		int32 NumMembers;
+		uint8 bIsUniqueName;
+		uint8 UnderlyingTypeSize;
+		uint8 Pad_0[0x2];
+	};
+
+	struct Member
+	{
+		StringRef RawName;
+		StringRef UniqueName;
+		uint64 PropertyFlags;
+		int32 Offset;
+		int32 Size;
+		int32 ArrayDim;
+		int32 TypeIndex;
+		uint8 bIsBitField;
+		uint8 BitIndex;
+		uint8 FieldMask;
+		uint8 Pad_0[0x5];
+	};
+
+	struct PropType
+	{
+		uint64 CastFlags;
+		int32 ReferencedStructIndex;
+		int32 ReferencedEnumIndex;
+		int32 InnerTypes[2];
+	};
+
+	struct EnumMember
+	{
+		uint64 Value;
+		StringRef UniqueName;
+	};
+
+	/* Records are read in place from 8-byte aligned sections, their layout must be the same for every compiler */
+	static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 0x40 && offsetof(Header, GameName) == 0x30);
+	static_assert(std::is_trivially_copyable_v<Package> && sizeof(Package) == 0x24 && offsetof(Package, bIsEmpty) == 0x20);
+	static_assert(std::is_trivially_copyable_v<Struct> && sizeof(Struct) == 0x40 && offsetof(Struct, NumFunctions) == 0x38 && offsetof(Struct, bIsUniqueName) == 0x3C);
+	static_assert(std::is_trivially_copyable_v<Function> && sizeof(Function) == 0x30 && offsetof(Function, NumParams) == 0x2C);
+	static_assert(std::is_trivially_copyable_v<Enum> && sizeof(Enum) == 0x1C && offsetof(Enum, bIsUniqueName) == 0x18);
+	static_assert(std::is_trivially_copyable_v<Member> && sizeof(Member) == 0x30 && offsetof(Member, PropertyFlags) == 0x10 && offsetof(Member, bIsBitField) == 0x28);
+	static_assert(std::is_trivially_copyable_v<PropType> && sizeof(PropType) == 0x18 && offsetof(PropType, InnerTypes) == 0x10);
+	static_assert(std::is_trivially_copyable_v<EnumMember> && sizeof(EnumMember) == 0x10 && offsetof(EnumMember, UniqueName) == 0x08);
+	static_assert(alignof(Member) <= 0x8 && alignof(PropType) <= 0x8 && alignof(EnumMember) <= 0x8);
+}
+
+class IRManager
+{
+private:
+	static inline SDKIR IR;
+
+	static inline bool bIsInitialized = false;
+
+private:
+	static int32 AddPropertyType(UEProperty Property);
+	static int32 AddMembers(const MemberManager& Members);
+
+	static void InitStruct(int32 DenseIndex);
+	static void InitFunction(int32 DenseIndex);
+	static void InitEnum(int32 DenseIndex);
+	static void InitPackage(int32 DenseIndex);
+
+	/* Checks that all indices and ranges of an IR read from a file are within the bounds of their arrays */
+	static bool IsValidIR(const SDKIR& InIR);
+
+public:
+	/* Requires all other managers to be initialized. Called by Generator::Generate() for generators reading the IR, see Generator.h. */
+	static void Init();
+
+	/* Writes the IR to a binary file (see IRFile). Returns false if the file couldn't be written. */
+	static bool SaveToFile(const std::filesystem::path& FilePath);
+
+	/*
+	* Replaces the IR with one previously written by SaveToFile(). Doesn't require any other manager, or the game. Returns false if the file is truncated,
+	* or if any index or range in it is out of bounds. See Generator::InitFromIRFile().
+	*/
+	static bool LoadFromFile(const std::filesystem::path& FilePath);
+
+public:
+	static inline const SDKIR& GetIR()
+	{
+		return IR;
+	}
+};
@@ -2,10 +2,12 @@
 
 #include <unordered_map>
 #include <memory>
+#include <span>
 
 #include "ObjectArray.h"
 #include "HashStringTable.h"
 #include "CollisionManager.h"
+#include "DenseIndexManager.h"
 #include "PredefinedMembers.h"
 
 
@@ -19,7 +21,8 @@ private:
 private:
 	const std::shared_ptr<class StructWrapper> Struct;
 
-	const std::vector<UEProperty>& Members;
+	std::span<const UEProperty> Members;
+	std::span<const NameInfo> MemberNameInfos;
 	const std::vector<PredefType>* PredefElements;
 
 	int32 CurrentIdx = 0x0;
@@ -28,8 +31,8 @@ private:
 	bool bIsCurrentlyPredefined = true;
 
 public:
-	inline MemberIterator(const std::shared_ptr<class StructWrapper>& Str, const std::vector<UEProperty>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
-		: Struct(Str), Members(Mbr), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
+	inline MemberIterator(const std::shared_ptr<class StructWrapper>& Str, std::span<const UEProperty> Mbr, std::span<const NameInfo> MbrNames, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
+		: Struct(Str), Members(Mbr), MemberNameInfos(MbrNames), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
 	{
 		const int32 NextUnrealOffset = GetUnrealMemberOffset();
 		const int32 NextPredefOffset = GetPredefMemberOffset();
@@ -49,13 +52,13 @@ private:
 	inline bool IsValidUnrealMemberIndex() const { return CurrentIdx < Members.size(); }
 	inline bool IsValidPredefMemberIndex() const { return PredefElements ? CurrentPredefIdx < PredefElements->size() : false; }
 
-	int32 GetUnrealMemberOffset() const { return IsValidUnrealMemberIndex() ? Members.at(CurrentIdx).GetOffset() : 0xFFFFFFF; }
+	int32 GetUnrealMemberOffset() const { return IsValidUnrealMemberIndex() ? Members[CurrentIdx].GetOffset() : 0xFFFFFFF; }
 	int32 GetPredefMemberOffset() const { return IsValidPredefMemberIndex() ? PredefElements->at(CurrentPredefIdx).Offset : 0xFFFFFFF; }
 
 public:
 	DereferenceType operator*() const
 	{
-		return bIsCurrentlyPredefined ? DereferenceType(Struct, &PredefElements->at(CurrentPredefIdx)) : DereferenceType(Struct, Members.at(CurrentIdx));
+		return bIsCurrentlyPredefined ? DereferenceType(Struct, &PredefElements->at(CurrentPredefIdx)) : DereferenceType(Struct, Members[CurrentIdx], MemberNameInfos[CurrentIdx]);
 	}
 
 	inline MemberIterator& operator++()
@@ -77,7 +80,7 @@ public:
 public:
 	inline MemberIterator begin() const { return *this; }
 
-	inline MemberIterator end() const { return MemberIterator(Struct, Members, PredefElements, Members.size(), PredefElements ? PredefElements->size() : 0x0); }
+	inline MemberIterator end() const { return MemberIterator(Struct, Members, MemberNameInfos, PredefElements, Members.size(), PredefElements ? PredefElements->size() : 0x0); }
 };
 
 template<bool bIsDeferredTemplateCreation = true>
@@ -90,7 +93,8 @@ private:
 private:
 	const std::shared_ptr<StructWrapper> Struct;
 
-	const std::vector<UEFunction>& Members;
+	std::span<const UEFunction> Members;
+	std::span<const NameInfo> MemberNameInfos;
 	const std::vector<PredefType>* PredefElements;
 
 	int32 CurrentIdx = 0x0;
@@ -99,8 +103,8 @@ private:
 	bool bIsCurrentlyPredefined = true;
 
 public:
-	inline FunctionIterator(const std::shared_ptr<StructWrapper>& Str, const std::vector<UEFunction>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
-		: Struct(Str), Members(Mbr), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
+	inline FunctionIterator(const std::shared_ptr<StructWrapper>& Str, std::span<const UEFunction> Mbr, std::span<const NameInfo> MbrNames, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
+		: Struct(Str), Members(Mbr), MemberNameInfos(MbrNames), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
 	{
 		bIsCurrentlyPredefined = bShouldNextMemberBePredefined();
 	}
@@ -109,7 +113,7 @@ private:
 	/* bIsFunction */
 	inline bool IsNextPredefFunctionInline() const { return PredefElements ? PredefElements->at(CurrentPredefIdx).bIsBodyInline : false; }
 	inline bool IsNextPredefFunctionStatic() const { return PredefElements ? PredefElements->at(CurrentPredefIdx).bIsStatic : false; }
-	inline bool IsNextUnrealFunctionInline() const { return HasMoreUnrealMembers() ? Members.at(CurrentIdx).HasFlags(EFunctionFlags::Static) : false; }
+	inline bool IsNextUnrealFunctionInline() const { return HasMoreUnrealMembers() ? Members[CurrentIdx].HasFlags(EFunctionFlags::Static) : false; }
 
 	inline bool HasMorePredefMembers() const { return PredefElements ? CurrentPredefIdx < PredefElements->size() : false; }
 	inline bool HasMoreUnrealMembers() const { return CurrentIdx < Members.size(); }
@@ -136,7 +140,7 @@ private:
 				return true;
 
 			// Switch from static predefs to static unreal functions
-			if (bHasMoreUnrealMembers && Members.at(CurrentIdx).HasFlags(EFunctionFlags::Static))
+			if (bHasMoreUnrealMembers && Members[CurrentIdx].HasFlags(EFunctionFlags::Static))
 				return false;
 
 			return !PredefFunc.bIsBodyInline || !bHasMoreUnrealMembers;
@@ -148,7 +152,7 @@ private:
 public:
 	inline DereferenceType operator*() const
 	{
-		return bIsCurrentlyPredefined ? DereferenceType(Struct, &PredefElements->at(CurrentPredefIdx)) : DereferenceType(Struct, Members.at(CurrentIdx));
+		return bIsCurrentlyPredefined ? DereferenceType(Struct, &PredefElements->at(CurrentPredefIdx)) : DereferenceType(Struct, Members[CurrentIdx], MemberNameInfos[CurrentIdx]);
 	}
 
 	inline FunctionIterator& operator++()
@@ -167,7 +171,7 @@ public:
 public:
 	inline FunctionIterator begin() const { return *this; }
 
-	inline FunctionIterator end() const { return FunctionIterator(Struct, Members, PredefElements, Members.size(), PredefElements ? PredefElements->size() : 0x0); }
+	inline FunctionIterator end() const { return FunctionIterator(Struct, Members, MemberNameInfos, PredefElements, Members.size(), PredefElements ? PredefElements->size() : 0x0); }
 };
 
 
@@ -180,25 +184,61 @@ private:
 	friend class CollisionManagerTest;
 
 private:
-	/* Map to lookup if a struct has predefined members */
-	static inline const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
+	/* Range of the sorted members and functions of one struct/function within the shared arrays below */
+	struct SortedMemberView
+	{
+		std::shared_ptr<StructWrapper> Struct;
+
+		int32 MembersOffset = 0x0;
+		int32 NumMembers = 0x0;
+
+		int32 FunctionsOffset = 0x0;
+		int32 NumFunctions = 0x0;
+	};
+
+private:
+	/* Members and functions of all structs and functions, sorted once by InitSortedMembers() and shared by every MemberManager */
+	static inline std::vector<UEProperty> SortedMembers;
+	static inline std::vector<UEFunction> SortedFunctions;
+
+	/* NameInfos of SortedMembers and SortedFunctions, at the same positions */
+	static inline std::vector<NameInfo> SortedMemberNameInfos;
+	static inline std::vector<NameInfo> SortedFunctionNameInfos;
+
+	/* Views indexed by the dense struct-index and dense function-index respectively */
+	static inline std::vector<SortedMemberView> StructViews;
+	static inline std::vector<SortedMemberView> FunctionViews;
+
+	/* Table to lookup if a struct has predefined members */
+	static inline const PredefinedMemberLookupTable* PredefinedMemberLookup = nullptr;
 
 	/* CollisionManager containing information on colliding member-/function-names */
 	static inline CollisionManager MemberNames;
 
+	static inline bool bIsInitialized = false;
+	static inline bool bIsSortedMembersInitialized = false;
+
 private:
 	const std::shared_ptr<StructWrapper> Struct;
 
-	std::vector<UEProperty> Members;
-	std::vector<UEFunction> Functions;
+	std::span<const UEProperty> Members;
+	std::span<const UEFunction> Functions;
+
+	/* NameInfos of Members and Functions, sorted the same way */
+	std::span<const NameInfo> MemberNameInfos;
+	std::span<const NameInfo> FunctionNameInfos;
 
 	const std::vector<PredefinedMember>* PredefMembers = nullptr;
 	const std::vector<PredefinedFunction>* PredefFunctions = nullptr;
 
 private:
+	MemberManager(const SortedMemberView& View);
 	MemberManager(UEStruct Str);
 	MemberManager(const PredefinedStruct* Str);
 
+private:
+	static const SortedMemberView& GetSortedView(UEStruct Str);
+
 public:
 	int32 GetNumFunctions() const;
 	int32 GetNumMembers() const;
@@ -213,7 +253,7 @@ public:
 	FunctionIterator<true> IterateFunctions() const;
 
 public:
-	static inline void SetPredefinedMemberLookupPtr(const PredefinedMemberLookupMapType* Lookup)
+	static inline void SetPredefinedMemberLookupPtr(const PredefinedMemberLookupTable* Lookup)
 	{
 		PredefinedMemberLookup = Lookup;
 	}
@@ -224,25 +264,30 @@ public:
 	/* Fixes the casing of FRotator members. pitch -> Pitch, yaw -> Yaw, roll -> Roll */
 	static void FixIncorrectNames();
 
+	/* Sorts the members and functions of all structs and functions once. Requires StructManager and MemberManager to be initialized. */
+	static void InitSortedMembers();
+
 	static inline void Init()
 	{
-		static bool bInitialized = false;
-
-		if (bInitialized)
+		if (bIsInitialized)
 			return;
 
-		bInitialized = true;
+		bIsInitialized = true;
 
 		/* Adds special names first, to avoid name-collisions with predefined members */
 		InitReservedNames();
 
 		/* Initialize member-name collisions  */
-		for (auto Obj : ObjectArray())
+		for (const int32 StructIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Struct))
+			AddStructToNameContainer(ObjectArray::GetByIndex<UEStruct>(StructIdx));
+
+		/* Functions outside of structs, like package-level delegate-signatures, don't get their slice through an outer struct */
+		for (const int32 FuncIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Function))
 		{
-			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
-				continue;
+			const UEStruct Func = ObjectArray::GetByIndex<UEStruct>(FuncIdx);
 
-			AddStructToNameContainer(Obj.Cast<UEStruct>());
+			if (!Func.GetOuter().IsA(EClassCastFlags::Struct))
+				AddStructToNameContainer(Func);
 		}
 
 		FixIncorrectNames();
@@ -253,17 +298,6 @@ public:
 		MemberNames.AddStructToNameContainer(Struct, (!Struct.IsA(EClassCastFlags::Class) && !Struct.IsA(EClassCastFlags::Function)));
 	}
 
-	template<typename UEType>
-	static inline NameInfo GetNameCollisionInfo(UEStruct Struct, UEType Member)
-	{
-		static_assert(std::is_same_v<UEType, UEProperty> || std::is_same_v<UEType, UEFunction>, "Type arguement in 'GetNameCollisionInfo' is of invalid type!");
-
-		assert(Struct && "'GetNameCollisionInfo()' called with 'Struct' == nullptr");
-		assert(Member && "'GetNameCollisionInfo()' called with 'Member' == nullptr");
-		
-		return MemberNames.GetNameCollisionInfoUnchecked(Struct, Member);
-	}
-
 	static inline std::string StringifyName(UEStruct Struct, NameInfo Name)
 	{
 		return MemberNames.StringifyName(Struct, Name);
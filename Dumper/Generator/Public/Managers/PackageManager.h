@@ -1,9 +1,13 @@
 #pragma once
 
+#include <set>
+
 #include "Unreal/Enums.h"
 #include "Unreal/UnrealObjects.h"
 
 #include "Managers/DependencyManager.h"
+#include "Managers/DependencyGraph.h"
+#include "Managers/DenseIndexManager.h"
 #include "HashStringTable.h"
 
 
@@ -22,22 +26,14 @@ struct RequirementInfo
 	bool bShouldIncludeClasses;
 };
 
-struct VisitedNodeInformation
-{
-	int32 PackageIdx;
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-};
-
 using DependencyListType = std::unordered_map<int32, RequirementInfo>;
 
+/* Ordered, to keep the order of includes stable */
+using ForwardDeclarationListType = std::set<int32>;
+
 
 struct DependencyInfo
 {
-	/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-
 	/* List of packages required by "ThisPackage_structs.h" */
 	DependencyListType StructsDependencies;
 
@@ -46,17 +42,13 @@ struct DependencyInfo
 
 	/* List of packages required by "ThisPackage_parameters.h" */
 	DependencyListType ParametersDependencies;
-};
 
-struct IncludeData
-{
-	bool bIncludedStructs = false;
-	bool bIncludedClasses = false;
+	/* Packages of which only enums are required, "PackageName_fwd.hpp" is included instead if the package isn't in the respective list above */
+	ForwardDeclarationListType StructsForwardDeclarations;
+	ForwardDeclarationListType ClassesForwardDeclarations;
+	ForwardDeclarationListType ParametersForwardDeclarations;
 };
 
-using VisitedNodeContainerType = std::unordered_map<int32, IncludeData>;
-
-
 struct PackageInfo
 {
 private:
@@ -131,7 +123,7 @@ public:
 	void ErasePackageDependencyFromClasses(int32 Package) const;
 };
 
-using PackageManagerOverrideMapType = std::unordered_map<int32 /* PackageIndex */, PackageInfo>;
+using PackageInfoListType = std::vector<PackageInfo>;
 
 struct PackageInfoIterator
 {
@@ -139,28 +131,28 @@ private:
 	friend class PackageManager;
 
 private:
-	using MapType = PackageManagerOverrideMapType;
-	using IteratorType = PackageManagerOverrideMapType::const_iterator;
+	using ListType = PackageInfoListType;
+	using IteratorType = PackageInfoListType::const_iterator;
 
 private:
-	const MapType& PackageInfos;
+	const ListType& PackageInfos;
 	uint8 CurrentIterationHitCount;
 	IteratorType It;
 
 private:
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount, IteratorType ItPos)
+	explicit PackageInfoIterator(const ListType& Infos, uint8 IterationHitCount, IteratorType ItPos)
 		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(ItPos)
 	{
 	}
 
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount)
+	explicit PackageInfoIterator(const ListType& Infos, uint8 IterationHitCount)
 		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(Infos.cbegin())
 	{
 	}
 
 public:
 	inline PackageInfoIterator& operator++() { ++It; return *this; }
-	inline PackageInfoHandle operator*() const { return { PackageInfoHandle(It->second) }; }
+	inline PackageInfoHandle operator*() const { return { PackageInfoHandle(*It) }; }
 
 	inline bool operator==(const PackageInfoIterator& Other) const { return It == Other.It; }
 	inline bool operator!=(const PackageInfoIterator& Other) const { return It != Other.It; }
@@ -176,10 +168,6 @@ struct PackageManagerIterationParams
 	int32 RequiredPackage;
 
 	bool bWasPrevNodeStructs;
-	bool bRequiresClasses;
-	bool bRequiresStructs;
-
-	VisitedNodeContainerType& VisitedNodes;
 };
 
 class PackageManager
@@ -189,36 +177,32 @@ private:
 	friend class PackageManagerTest;
 
 public:
-	using OverrideMaptType = PackageManagerOverrideMapType;
+	using InfoListType = PackageInfoListType;
 
-	using IteratePackagesCallbackType = std::function<void(const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct)>;
-	using FindCycleCallbackType = std::function<void(const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct)>;
+	using IteratePackagesCallbackType = std::function<void(const PackageManagerIterationParams& Params, bool bIsStruct)>;
+	using FindCycleCallbackType = std::function<void(const PackageManagerIterationParams& Params, bool bIsStruct)>;
 
 private:
-	struct SingleDependencyIterationParamsInternal
+	/*
+	* Graph of the "_structs.hpp" and "_classes.hpp" files of all packages.
+	*
+	* Node (2 * i) is the structs-file of the package with the dense package-index 'i', node (2 * i + 1) the classes-file. Edges follow the order of the DependencyListType maps.
+	*/
+	struct PackageDependencyGraph
 	{
-		const IteratePackagesCallbackType& CallbackForEachPackage;
-		const FindCycleCallbackType& OnFoundCycle;
-
-		PackageManagerIterationParams& NewParams;
-		const PackageManagerIterationParams& OldParams;
-		const DependencyListType& Dependencies;
-		VisitedNodeContainerType& VisitedNodes;
-
-		int32 CurrentIndex;
-		int32 PrevIndex;
-		uint64& IterationHitCounterRef;
+		DependencyGraph Graph;
 
-		bool bShouldHandlePackage;
-		bool bIsStruct;
+		static inline int32 GetNode(int32 DenseIndex, bool bIsStruct) { return (DenseIndex * 2) + (bIsStruct ? 0 : 1); }
+		static inline int32 GetDenseIndex(int32 Node) { return Node / 2; }
+		static inline bool IsStructNode(int32 Node) { return (Node % 2) == 0; }
 	};
 
 private:
 	/* NameTable containing names of all Packages as well as information on name-collisions */
 	static inline HashStringTable UniquePackageNameTable;
 
-	/* Map containing infos on all Packages. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
-	static inline OverrideMaptType PackageInfos;
+	/* Infos on all Packages, indexed by their dense package-index. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
+	static inline InfoListType PackageInfos;
 
 	/* Count to track how often the PackageInfos was iterated. Allows for up to 2^64 iterations of this list. */
 	static inline uint64 CurrentIterationHitCount = 0x0;
@@ -249,17 +233,28 @@ private:
 		return UniquePackageNameTable[Info.Name];
 	}
 
+	static inline PackageInfo& GetInfoRef(int32 PackageIndex)
+	{
+		return PackageInfos.at(DenseIndexManager::GetDenseIndex(PackageIndex, EDenseIndexType::Package));
+	}
+
 private:
-	static void IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle);
+	static PackageDependencyGraph BuildPackageDependencyGraph();
 
-	static void IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle);
+	static void IterateDependenciesImplementation(const PackageDependencyGraph& PackageGraph, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle);
 
 public:
 	static void IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage);
 	static void FindCycle(const FindCycleCallbackType& OnFoundCycle);
 
+	/*
+	* Collects all packages required to compile the RootPackages, including themselves, by following the include-dependencies of their files.
+	* Packages only required through their '_fwd.hpp' file, and not included otherwise, are added to OutForwardDeclaredPackages instead.
+	*/
+	static void GetRequiredPackages(const std::vector<int32>& RootPackages, std::unordered_set<int32>& OutPackages, std::unordered_set<int32>& OutForwardDeclaredPackages);
+
 public:
-	static inline const OverrideMaptType& GetPackageInfos()
+	static inline const InfoListType& GetPackageInfos()
 	{
 		return PackageInfos;
 	}
@@ -276,7 +271,7 @@ public:
 
 	static inline PackageInfoHandle GetInfo(int32 PackageIndex)
 	{
-		return PackageInfos.at(PackageIndex);
+		return GetInfoRef(PackageIndex);
 	}
 
 	static inline PackageInfoHandle GetInfo(const UEObject Package)
@@ -284,7 +279,7 @@ public:
 		if (!Package)
 			return {};
 
-		return PackageInfos.at(Package.GetIndex());
+		return GetInfoRef(Package.GetIndex());
 	}
 
 	static inline PackageInfoIterator IterateOverPackageInfos()
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
+#include <algorithm>
 
 #include "Unreal/UnrealObjects.h"
+#include "Managers/DenseIndexManager.h"
 #include "HashStringTable.h"
 
 
@@ -81,24 +82,27 @@ private:
 	friend class StructManagerTest;
 
 public:
-	using OverrideMapType = std::unordered_map<int32 /*StructIdx*/, StructInfo>;
-	using CycleInfoListType = std::unordered_map<int32 /*StructIdx*/, std::unordered_set<int32 /* Packages cyclic with this structs' package */>>;
+	using StructInfoListType = std::vector<StructInfo>;
+	using CycleInfoListType = std::vector<std::vector<int32 /* Packages cyclic with this structs' package */>>;
 
 private:
 	/* NameTable containing names of all structs/classes as well as information on name-collisions */
 	static inline HashStringTable UniqueNameTable;
 
-	/* Map containing infos on all structs/classes. Implemented due to bugs/inconsistencies in Unreal's reflection system */
-	static inline OverrideMapType StructInfoOverrides;
+	/* Infos on all structs/classes, indexed by their dense struct-index. Implemented due to bugs/inconsistencies in Unreal's reflection system */
+	static inline StructInfoListType StructInfos;
 
-	/* Map containing infos on all structs/classes that are within a packages that has cyclic dependencies */
+	/* Infos on all functions (parameter-structs), indexed by their dense function-index */
+	static inline StructInfoListType FunctionInfos;
+
+	/* Packages cyclic with the package of a struct/class, indexed by the dense struct-index. Empty for structs not within a package that has cyclic dependencies. */
 	static inline CycleInfoListType CyclicStructsAndPackages;
 
 	static inline bool bIsInitialized = false;
 
 private:
-	static void InitAlignmentsAndNames();
-	static void InitSizesAndIsFinal();
+	static void InitNames();
+	static void InitLayouts();
 
 public:
 	static void Init();
@@ -109,10 +113,19 @@ private:
 		return UniqueNameTable[Info.Name];
 	}
 
+	static inline StructInfo& GetInfoRef(int32 StructIndex)
+	{
+		if (DenseIndexManager::GetType(StructIndex) == EDenseIndexType::Function)
+			return FunctionInfos.at(DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Function));
+
+		return StructInfos.at(DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Struct));
+	}
+
 public:
-	static inline const OverrideMapType& GetStructInfos()
+	/* Infos on all structs/classes, excluding functions. Use DenseIndexManager::GetObjectIndex() to get the index of the struct. */
+	static inline const StructInfoListType& GetStructInfos()
 	{
-		return StructInfoOverrides;
+		return StructInfos;
 	}
 
 	static inline bool IsStructNameUnique(HashStringTableIndex NameIndex)
@@ -131,16 +144,19 @@ public:
 		if (!Struct)
 			return {};
 
-		return StructInfoOverrides.at(Struct.GetIndex());
+		return GetInfoRef(Struct.GetIndex());
 	}
 
 	static inline bool IsStructCyclicWithPackage(int32 StructIndex, int32 PackageIndex)
 	{
-		auto It = CyclicStructsAndPackages.find(StructIndex);
-		if (It != CyclicStructsAndPackages.end())
-			return It->second.contains(PackageIndex);
+		const int32 DenseIndex = DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Struct);
+
+		if (DenseIndex == -1)
+			return false;
+
+		const std::vector<int32>& CyclicPackages = CyclicStructsAndPackages[DenseIndex];
 
-		return false;
+		return std::find(CyclicPackages.begin(), CyclicPackages.end(), PackageIndex) != CyclicPackages.end();
 	}
 
 	/* 
@@ -150,12 +166,14 @@ public:
 	*/
 	static inline void PackageManagerSetCycleForStruct(int32 StructIndex, int32 PackageIndex)
 	{
-		StructInfo& Info = StructInfoOverrides.at(StructIndex);
+		StructInfo& Info = GetInfoRef(StructIndex);
 
 		Info.bIsPartOfCyclicPackage = true;
 
+		std::vector<int32>& CyclicPackages = CyclicStructsAndPackages.at(DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Struct));
 
-		CyclicStructsAndPackages[StructIndex].insert(PackageIndex);
+		if (std::find(CyclicPackages.begin(), CyclicPackages.end(), PackageIndex) == CyclicPackages.end())
+			CyclicPackages.push_back(PackageIndex);
 	}
 };
 
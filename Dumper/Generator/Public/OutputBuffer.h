@@ -0,0 +1,96 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <format>
+#include <charconv>
+#include <iterator>
+#include <concepts>
+#include <filesystem>
+
+#include "Unreal/Enums.h"
+
+
+/*
+* Growable in-memory output buffer used by the generators instead of std::ofstream.
+*
+* Text is appended through operator<< or Format(), which formats directly into the buffer with std::format_to instead of creating a temporary
+* std::string per fragment. The content is written to disk with a single write call in WriteToFile().
+*/
+class OutputBuffer
+{
+private:
+	static constexpr size_t DefaultInitialCapacity = 0x10000;
+
+private:
+	std::string Data;
+
+public:
+	OutputBuffer(size_t InitialCapacity = DefaultInitialCapacity)
+	{
+		Data.reserve(InitialCapacity);
+	}
+
+	OutputBuffer(const OutputBuffer&) = delete;
+	OutputBuffer(OutputBuffer&&) = default;
+
+	OutputBuffer& operator=(const OutputBuffer&) = delete;
+	OutputBuffer& operator=(OutputBuffer&&) = default;
+
+public:
+	template<typename... ArgTypes>
+	inline void Format(std::format_string<ArgTypes...> Fmt, ArgTypes&&... Args)
+	{
+		std::format_to(std::back_inserter(Data), Fmt, std::forward<ArgTypes>(Args)...);
+	}
+
+	/* Appends raw bytes, used for binary files */
+	inline void Write(const void* Bytes, size_t Size)
+	{
+		Data.append(static_cast<const char*>(Bytes), Size);
+	}
+
+	inline OutputBuffer& operator<<(std::string_view Str)
+	{
+		Data.append(Str);
+		return *this;
+	}
+
+	inline OutputBuffer& operator<<(char Char)
+	{
+		Data.push_back(Char);
+		return *this;
+	}
+
+	template<typename T> requires(std::integral<T> && !std::same_as<T, char> && !std::same_as<T, bool>)
+	inline OutputBuffer& operator<<(T Value)
+	{
+		char Buffer[0x18];
+		Data.append(Buffer, std::to_chars(Buffer, Buffer + sizeof(Buffer), Value).ptr);
+
+		return *this;
+	}
+
+	/* Same output as std::ostream with default flags, which uses a precision of 6 significant digits */
+	template<typename T> requires(std::floating_point<T>)
+	inline OutputBuffer& operator<<(T Value)
+	{
+		char Buffer[0x20];
+		Data.append(Buffer, std::to_chars(Buffer, Buffer + sizeof(Buffer), static_cast<double>(Value), std::chars_format::general, 6).ptr);
+
+		return *this;
+	}
+
+public:
+	inline std::string_view View() const { return Data; }
+	inline size_t Size() const { return Data.size(); }
+	inline bool IsEmpty() const { return Data.empty(); }
+
+	inline void Clear() { Data.clear(); }
+
+	/*
+	* Writes the whole buffer at once. Files opened in text-mode get the same newline-translation as with std::ofstream.
+	* The file is left untouched if the FileManifest shows it already has this content. Returns false if the file couldn't be written.
+	*/
+	bool WriteToFile(const std::filesystem::path& FilePath, bool bIsBinary = false) const;
+};
@@ -1,10 +1,10 @@
 #pragma once
 #include <string>
 #include <vector>
-#include <unordered_map>
 
 #include "Unreal/Enums.h"
 #include "Unreal/UnrealObjects.h"
+#include "Managers/DenseIndexManager.h"
 
 struct PredefinedMember
 {
@@ -66,8 +66,38 @@ struct PredefinedStruct
     std::vector<PredefinedFunction> Functions;
 };
 
-/* unordered_map<StructIndex, Members/Functions> */
-using PredefinedMemberLookupMapType = std::unordered_map<int32 /* StructIndex */, PredefinedElements /* Members/Functions */>;
+/* Members/Functions added to existing structs, indexed by the dense struct-index of the struct */
+class PredefinedMemberLookupTable
+{
+private:
+    std::vector<PredefinedElements> Elements;
+
+public:
+    /* Returns the elements of the struct, the table is sized to hold all structs on first insertion */
+    inline PredefinedElements& operator[](int32 StructIndex)
+    {
+        if (Elements.empty())
+            Elements.resize(DenseIndexManager::GetNum(EDenseIndexType::Struct));
+
+        return Elements.at(DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Struct));
+    }
+
+    /* Returns nullptr if no elements were added for this struct */
+    inline const PredefinedElements* Find(int32 StructIndex) const
+    {
+        const int32 DenseIndex = DenseIndexManager::GetDenseIndex(StructIndex, EDenseIndexType::Struct);
+
+        if (DenseIndex < 0 || DenseIndex >= Elements.size())
+            return nullptr;
+
+        const PredefinedElements& Predefs = Elements[DenseIndex];
+
+        if (Predefs.Members.empty() && Predefs.Functions.empty())
+            return nullptr;
+
+        return &Predefs;
+    }
+};
 
 // requires strict weak ordering
 inline bool CompareUnrealProperties(UEProperty Left, UEProperty Right)
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+
+#include "Unreal/ObjectArray.h"
+#include "Generators/CppGenerator.h"
+#include "Managers/MemberManager.h"
+#include "Wrappers/StructWrapper.h"
+#include "Wrappers/MemberWrappers.h"
+
+
+/* Runs against the objects of the game, after 'Generator::InitInternal()'. Enabled through 'Settings::Debug::bRunUnitTests'. */
+class CppGeneratorTest
+{
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestNativeFunctionCalls<bDoDebugPrinting>();
+	}
+
+	/* Wrappers calling 'BasicFilesImpleUtils::CallNativeFunction()' pass a stack-frame without 'Code', the function must not have parameters other than the return-value */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNativeFunctionCalls()
+	{
+		bool bSuccededTestWithoutError = true;
+		int32 NumTestedFunctions = 0x0;
+		int32 NumDirectCalls = 0x0;
+
+		for (const int32 StructIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Struct))
+		{
+			const UEClass Class = ObjectArray::GetByIndex<UEClass>(StructIdx);
+
+			if (!Class.IsA(EClassCastFlags::Class))
+				continue;
+
+			const MemberManager Members = StructWrapper(Class).GetMembers();
+
+			for (const FunctionWrapper& Func : Members.IterateFunctions())
+			{
+				if (Func.IsPredefined() || Func.HasFunctionFlag(EFunctionFlags::Delegate))
+					continue;
+
+				NumTestedFunctions++;
+
+				OutputBuffer FunctionFile(0x1000);
+				OutputBuffer ParamFile(0x1000);
+				OutputBuffer AssertionFile(0x100);
+
+				CppGenerator::GenerateSingleFunction(Func, Class.GetCppName(), FunctionFile, ParamFile, AssertionFile);
+
+				const std::string_view Implementation = FunctionFile.View();
+				const bool bCallsNativeDirectly = Implementation.find("BasicFilesImpleUtils::CallNativeFunction(") != std::string_view::npos;
+
+				if (bCallsNativeDirectly != CppGenerator::CanCallNativeFunctionDirectly(Func))
+				{
+					PrintDbgMessage<bDoDebugPrinting>("Function '{}' {} CallNativeFunction unexpectedly!", Func.GetUnrealFunction().GetFullName(), bCallsNativeDirectly ? "uses" : "doesn't use");
+					bSuccededTestWithoutError = false;
+				}
+
+				if (!bCallsNativeDirectly)
+					continue;
+
+				NumDirectCalls++;
+
+				if (!Func.HasFunctionFlag(EFunctionFlags::Native))
+				{
+					PrintDbgMessage<bDoDebugPrinting>("Function '{}' isn't native, but calls CallNativeFunction!", Func.GetUnrealFunction().GetFullName());
+					bSuccededTestWithoutError = false;
+				}
+
+				for (UEProperty Param : Func.GetUnrealFunction().GetProperties())
+				{
+					if (Param.HasPropertyFlags(EPropertyFlags::ReturnParm))
+						continue;
+
+					PrintDbgMessage<bDoDebugPrinting>("Function '{}' calls CallNativeFunction, but has parameter '{}'!", Func.GetUnrealFunction().GetFullName(), Param.GetName());
+					bSuccededTestWithoutError = false;
+				}
+
+				/* Assignments to input-parameters, 'return Parms.ReturnValue;' is fine */
+				if (Implementation.find("\n\tParms.") != std::string_view::npos)
+				{
+					PrintDbgMessage<bDoDebugPrinting>("Function '{}' calls CallNativeFunction, but assigns parameters!", Func.GetUnrealFunction().GetFullName());
+					bSuccededTestWithoutError = false;
+				}
+			}
+		}
+
+		std::cerr << std::format("CppGeneratorTest::TestNativeFunctionCalls: {} ({} functions, {} called directly)\n", bSuccededTestWithoutError ? "succeeded" : "failed", NumTestedFunctions, NumDirectCalls);
+	}
+
+private:
+	template<bool bDoDebugPrinting = false, typename... Ts>
+	static inline void PrintDbgMessage(std::format_string<Ts...> Message, Ts&&... Args)
+	{
+		if constexpr (bDoDebugPrinting)
+			std::cerr << std::format(Message, std::forward<Ts>(Args)...) << '\n';
+	}
+};
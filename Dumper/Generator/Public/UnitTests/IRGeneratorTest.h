@@ -0,0 +1,228 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <cstring>
+#include <unordered_set>
+
+#include "Managers/IRManager.h"
+#include "Generators/MappingGenerator.h"
+#include "Generators/IDAMappingGenerator.h"
+
+
+/*
+* Runs the generators reading the IR against a small synthetic SDKIR and parses their output. Doesn't require the game, or any other manager.
+* Enabled through 'Settings::Debug::bRunUnitTests'.
+*/
+class IRGeneratorTest
+{
+private:
+	/* Reads values from the binary output of a generator, reads past the end only clear 'bIsValid' */
+	struct FOutputReader
+	{
+		std::string_view Data;
+		size_t Offset = 0x0;
+		bool bIsValid = true;
+
+		template<typename T>
+		T Read()
+		{
+			T Value = {};
+
+			if (Offset + sizeof(T) > Data.size())
+			{
+				bIsValid = false;
+				return Value;
+			}
+
+			std::memcpy(&Value, Data.data() + Offset, sizeof(T));
+			Offset += sizeof(T);
+
+			return Value;
+		}
+
+		std::string ReadString(size_t Length)
+		{
+			if (Offset + Length > Data.size())
+			{
+				bIsValid = false;
+				return "";
+			}
+
+			std::string Str(Data.substr(Offset, Length));
+			Offset += Length;
+
+			return Str;
+		}
+	};
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestMappingGenerator<bDoDebugPrinting>();
+		TestIDAMappingGenerator<bDoDebugPrinting>();
+	}
+
+	/* Structs and enums are referenced by their index, the name of the referenced one is written even if another struct has the same raw name */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMappingGenerator()
+	{
+		const SDKIR IR = CreateTestIR();
+
+		const OutputBuffer FileData = MappingGenerator::GenerateFileData(IR);
+
+		bool bSuccededTestWithoutError = true;
+
+		auto Check = [&](bool bCondition, const char* Description) -> void
+		{
+			if (bCondition)
+				return;
+
+			PrintDbgMessage<bDoDebugPrinting>("MappingGenerator: {}", Description);
+			bSuccededTestWithoutError = false;
+		};
+
+		FOutputReader Reader = { FileData.View() };
+
+		std::vector<std::string> Names(Reader.Read<uint32>());
+
+		for (std::string& Name : Names)
+			Name = Reader.ReadString(Reader.Read<uint16>());
+
+		auto ReadName = [&]() -> std::string
+		{
+			const int32 NameIndex = Reader.Read<int32>();
+
+			return NameIndex >= 0 && NameIndex < Names.size() ? Names[NameIndex] : "INVALID";
+		};
+
+		Check(Reader.Read<uint32>() == 0x1, "Expected one enum");
+		Check(ReadName() == "EFoo", "Expected enum 'EFoo'");
+		Check(Reader.Read<uint16>() == 0x2, "Expected two enum members");
+		Check(Reader.Read<uint64>() == 0x0 && ReadName() == "A", "Expected enum member 'A = 0'");
+		Check(Reader.Read<uint64>() == 0x1 && ReadName() == "B", "Expected enum member 'B = 1'");
+
+		Check(Reader.Read<uint32>() == 0x3, "Expected three structs");
+
+		/* Engine.Vector */
+		Check(ReadName() == "Vector" && Reader.Read<int32>() == -1, "Expected struct 'Vector' without super");
+		Check(Reader.Read<uint16>() == 0x1 && Reader.Read<uint16>() == 0x1, "Expected one property in 'Vector'");
+		Check(Reader.Read<uint16>() == 0x0 && Reader.Read<uint8>() == 0x1 && ReadName() == "X", "Expected property 'X'");
+		Check(Reader.Read<uint8>() == static_cast<uint8>(EMappingsTypeFlags::FloatProperty), "Expected 'X' to be a FloatProperty");
+
+		/* Engine.Actor */
+		Check(ReadName() == "Actor" && Reader.Read<int32>() == -1, "Expected class 'Actor' without super");
+		Check(Reader.Read<uint16>() == 0x2 && Reader.Read<uint16>() == 0x2, "Expected two properties in 'Actor'");
+		Check(Reader.Read<uint16>() == 0x0 && Reader.Read<uint8>() == 0x1 && ReadName() == "Location", "Expected property 'Location'");
+		Check(Reader.Read<uint8>() == static_cast<uint8>(EMappingsTypeFlags::StructProperty) && ReadName() == "Vector", "Expected 'Location' to be a StructProperty of 'Vector'");
+		Check(Reader.Read<uint16>() == 0x1 && Reader.Read<uint8>() == 0x1 && ReadName() == "Mode", "Expected property 'Mode'");
+		Check(Reader.Read<uint8>() == static_cast<uint8>(EMappingsTypeFlags::EnumProperty), "Expected 'Mode' to be written as an EnumProperty");
+		Check(Reader.Read<uint8>() == static_cast<uint8>(EMappingsTypeFlags::ByteProperty) && ReadName() == "EFoo", "Expected 'Mode' to be a ByteProperty of 'EFoo'");
+
+		/* Other.Vector */
+		Check(ReadName() == "Vector" && Reader.Read<int32>() == -1, "Expected second struct 'Vector'");
+		Check(Reader.Read<uint16>() == 0x0 && Reader.Read<uint16>() == 0x0, "Expected no properties in the second 'Vector'");
+
+		Check(Reader.bIsValid && Reader.Offset == FileData.Size(), "Expected the end of the data");
+
+		/* The name-table must not carry names over from the previous file */
+		Check(MappingGenerator::GenerateFileData(IR).View() == FileData.View(), "Expected identical data when generating twice");
+
+		std::cerr << std::format("IRGeneratorTest::TestMappingGenerator: {}\n", bSuccededTestWithoutError ? "succeeded" : "failed");
+	}
+
+	/* Exec-functions shared by multiple functions are only named once per file */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestIDAMappingGenerator()
+	{
+		const SDKIR IR = CreateTestIR();
+
+		auto GenerateIdmap = [&IR]() -> OutputBuffer
+		{
+			OutputBuffer IdmapFile;
+			std::unordered_set<uint32> NamedExecFunctions;
+
+			for (const IRStruct& Struct : IR.Structs)
+			{
+				if (!Struct.bIsClass)
+					continue;
+
+				IDAMappingGenerator::GenerateVTableName(IdmapFile, Struct);
+				IDAMappingGenerator::GenerateClassFunctions(IdmapFile, IR, Struct, NamedExecFunctions);
+			}
+
+			return IdmapFile;
+		};
+
+		const OutputBuffer IdmapFile = GenerateIdmap();
+
+		bool bSuccededTestWithoutError = true;
+
+		auto Check = [&](bool bCondition, const char* Description) -> void
+		{
+			if (bCondition)
+				return;
+
+			PrintDbgMessage<bDoDebugPrinting>("IDAMappingGenerator: {}", Description);
+			bSuccededTestWithoutError = false;
+		};
+
+		FOutputReader Reader = { IdmapFile.View() };
+
+		Check(Reader.Read<uint32>() == 0x1000 && Reader.ReadString(Reader.Read<uint16>()) == "AActor_VFT", "Expected the VTable of 'AActor'");
+		Check(Reader.Read<uint32>() == 0x2000 && Reader.ReadString(Reader.Read<uint16>()) == "_ZN6AActor15execGetLocationEv", "Expected the exec-function of 'GetLocation'");
+		Check(Reader.bIsValid && Reader.Offset == IdmapFile.Size(), "Expected 'K2_GetLocation' and 'Tick' to be skipped");
+
+		Check(GenerateIdmap().View() == IdmapFile.View(), "Expected identical data when generating twice");
+
+		std::cerr << std::format("IRGeneratorTest::TestIDAMappingGenerator: {}\n", bSuccededTestWithoutError ? "succeeded" : "failed");
+	}
+
+private:
+	/*
+	* Package 'Engine': enum 'EFoo', struct 'Vector', class 'Actor'
+	* Package 'Other':  struct 'Vector', with the same raw name as 'Engine.Vector'
+	*
+	* 'Actor::Location' is of type 'Other.Vector'. 'GetLocation' and 'K2_GetLocation' share one exec-function, 'Tick' isn't native.
+	*/
+	static inline SDKIR CreateTestIR()
+	{
+		SDKIR IR;
+
+		IR.Packages.resize(0x2);
+		IR.Packages[0] = { .Name = "Engine", .bIsEmpty = false, .Enums = { 0 }, .SortedStructs = { 0 }, .SortedClasses = { 1 } };
+		IR.Packages[1] = { .Name = "Other", .bIsEmpty = false, .SortedStructs = { 2 } };
+
+		IR.Enums.push_back({ .RawName = "EFoo", .UniqueName = "EFoo", .UnderlyingTypeSize = 0x1, .MembersOffset = 0x0, .NumMembers = 0x2 });
+		IR.EnumMembers = { { "A", 0x0 }, { "B", 0x1 } };
+
+		IR.PropertyTypes.push_back({ .CastFlags = EClassCastFlags::FloatProperty });
+		IR.PropertyTypes.push_back({ .CastFlags = EClassCastFlags::StructProperty, .ReferencedStructIndex = 0x2 });
+		IR.PropertyTypes.push_back({ .CastFlags = EClassCastFlags::ByteProperty, .ReferencedEnumIndex = 0x0 });
+
+		IR.Members.push_back({ .RawName = "X", .UniqueName = "X", .Offset = 0x0, .Size = 0x4, .TypeIndex = 0x0 });
+		IR.Members.push_back({ .RawName = "Location", .UniqueName = "Location", .Offset = 0x28, .Size = 0x18, .TypeIndex = 0x1 });
+		IR.Members.push_back({ .RawName = "Mode", .UniqueName = "Mode", .Offset = 0x40, .Size = 0x1, .TypeIndex = 0x2 });
+
+		IR.Structs.push_back({ .RawName = "Vector", .CppName = "FVector", .UniqueName = "FVector", .PackageIndex = 0x0, .Size = 0xC, .Alignment = 0x4, .MembersOffset = 0x0, .NumMembers = 0x1 });
+		IR.Structs.push_back({ .RawName = "Actor", .CppName = "AActor", .UniqueName = "AActor", .PackageIndex = 0x0, .Size = 0x48, .Alignment = 0x8, .bIsClass = true,
+			.VftOffset = 0x1000, .MembersOffset = 0x1, .NumMembers = 0x2, .FunctionsOffset = 0x0, .NumFunctions = 0x3 });
+		IR.Structs.push_back({ .RawName = "Vector", .CppName = "FVector", .UniqueName = "FVector", .bIsUniqueName = false, .PackageIndex = 0x1, .Size = 0x18, .Alignment = 0x8,
+			.MembersOffset = 0x3, .NumMembers = 0x0 });
+
+		IR.Functions.push_back({ .RawName = "GetLocation", .Name = "GetLocation", .UniqueName = "GetLocation", .OuterIndex = 0x1, .FunctionFlags = EFunctionFlags::Native, .ExecFunctionOffset = 0x2000 });
+		IR.Functions.push_back({ .RawName = "K2_GetLocation", .Name = "K2_GetLocation", .UniqueName = "K2_GetLocation", .OuterIndex = 0x1, .FunctionFlags = EFunctionFlags::Native, .ExecFunctionOffset = 0x2000 });
+		IR.Functions.push_back({ .RawName = "Tick", .Name = "Tick", .UniqueName = "Tick", .OuterIndex = 0x1 });
+		IR.FunctionIndices = { 0, 1, 2 };
+
+		return IR;
+	}
+
+	template<bool bDoDebugPrinting = false, typename... Ts>
+	static inline void PrintDbgMessage(std::format_string<Ts...> Message, Ts&&... Args)
+	{
+		if constexpr (bDoDebugPrinting)
+			std::cerr << std::format(Message, std::forward<Ts>(Args)...) << '\n';
+	}
+};
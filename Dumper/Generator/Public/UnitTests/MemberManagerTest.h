@@ -0,0 +1,71 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+
+#include "Unreal/ObjectArray.h"
+#include "Managers/MemberManager.h"
+#include "Wrappers/MemberWrappers.h"
+
+
+/* Runs against the objects of the game, after 'Generator::InitInternal()'. Enabled through 'Settings::Debug::bRunUnitTests'. */
+class MemberManagerTest
+{
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestStandaloneFunctionNames<bDoDebugPrinting>();
+	}
+
+	/* Functions outside of structs, like package-level delegate-signatures, must have names for all of their parameters */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStandaloneFunctionNames()
+	{
+		bool bSuccededTestWithoutError = true;
+		int32 NumTestedFunctions = 0x0;
+
+		for (const int32 FuncIdx : DenseIndexManager::GetObjectIndices(EDenseIndexType::Function))
+		{
+			const UEFunction Func = ObjectArray::GetByIndex<UEFunction>(FuncIdx);
+
+			if (Func.GetOuter().IsA(EClassCastFlags::Struct))
+				continue;
+
+			NumTestedFunctions++;
+
+			if (!MemberManager::MemberNames.HasNameSlice(FuncIdx))
+			{
+				PrintDbgMessage<bDoDebugPrinting>("Function '{}' has no name-slice!", Func.GetFullName());
+				bSuccededTestWithoutError = false;
+				continue;
+			}
+
+			const MemberManager Members(Func);
+
+			int32 NumNamedMembers = 0x0;
+
+			for (const PropertyWrapper& Member : Members.IterateMembers())
+			{
+				if (!Member.GetName().empty())
+					NumNamedMembers++;
+			}
+
+			if (NumNamedMembers != Func.GetProperties().size())
+			{
+				PrintDbgMessage<bDoDebugPrinting>("Function '{}' has {} named parameters, expected {}!", Func.GetFullName(), NumNamedMembers, Func.GetProperties().size());
+				bSuccededTestWithoutError = false;
+			}
+		}
+
+		std::cerr << std::format("MemberManagerTest::TestStandaloneFunctionNames: {} ({} functions)\n", bSuccededTestWithoutError ? "succeeded" : "failed", NumTestedFunctions);
+	}
+
+private:
+	template<bool bDoDebugPrinting = false, typename... Ts>
+	static inline void PrintDbgMessage(std::format_string<Ts...> Message, Ts&&... Args)
+	{
+		if constexpr (bDoDebugPrinting)
+			std::cerr << std::format(Message, std::forward<Ts>(Args)...) << '\n';
+	}
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <vector>
+
+#include "Unreal/UnrealContainers.h"
+
+
+/*
+* Runs 'UC::TSet::FindIndexByHash()' against synthetic TSet memory-images, laid out like the engine writes them. Doesn't require the game.
+* The bucket walk is the same as in the generated 'UnrealContainers.hpp'. Enabled through 'Settings::Debug::bRunUnitTests'.
+*/
+class UnrealContainersTest
+{
+private:
+	/* Memory-layout of 'UC::TSet<int32>' */
+	struct FInt32SetImage
+	{
+		/* ContainerImpl::SetElement<int32> */
+		struct FElement
+		{
+			int32 Value;
+			int32 HashNextId;
+			int32 HashIndex;
+		};
+
+		/* TSparseArray::Data */
+		FElement* Elements = nullptr;
+		int32 NumElements = 0x0;
+		int32 MaxElements = 0x0;
+
+		/* TSparseArray::AllocationFlags */
+		uint32 InlineAllocationFlags[0x4] = { 0x0 };
+		uint32* SecondaryAllocationFlags = nullptr;
+		int32 NumBits = 0x0;
+		int32 MaxBits = 0x0;
+
+		int32 FirstFreeIndex = -1;
+		int32 NumFreeIndices = 0x0;
+
+		/* TSet::Hash, an inline-allocator for one bucket */
+		int32 InlineHash = -1;
+		int32* SecondaryHash = nullptr;
+		int32 HashSize = 0x0;
+	};
+
+	static_assert(sizeof(FInt32SetImage) == sizeof(UC::TSet<int32>), "FInt32SetImage doesn't match the layout of UC::TSet<int32>!");
+
+	/* Owns the buffers an 'FInt32SetImage' points to, elements are hashed by their value, like 'GetTypeHash(int32)' */
+	struct FInt32Set
+	{
+		std::vector<FInt32SetImage::FElement> Elements;
+		std::vector<int32> Buckets;
+		FInt32SetImage Image;
+
+		FInt32Set(const std::vector<int32>& Values, int32 HashSize)
+			: Buckets(HashSize, -1)
+		{
+			for (const int32 Value : Values)
+			{
+				const int32 Bucket = Value & (HashSize - 1);
+
+				/* New elements are linked in at the front of their bucket */
+				Elements.push_back({ Value, Buckets[Bucket], Bucket });
+				Buckets[Bucket] = static_cast<int32>(Elements.size() - 1);
+			}
+
+			Image.Elements = Elements.data();
+			Image.NumElements = static_cast<int32>(Elements.size());
+			Image.MaxElements = static_cast<int32>(Elements.size());
+
+			Image.NumBits = static_cast<int32>(Elements.size());
+			Image.MaxBits = sizeof(Image.InlineAllocationFlags) * 0x8;
+
+			for (int32 i = 0; i < Image.NumBits; i++)
+				Image.InlineAllocationFlags[i / 0x20] |= 1u << (i % 0x20);
+
+			Image.HashSize = HashSize;
+
+			if (HashSize == 0x1)
+			{
+				Image.InlineHash = Buckets[0];
+			}
+			else
+			{
+				Image.SecondaryHash = Buckets.data();
+			}
+		}
+
+		void Free(int32 Index)
+		{
+			Image.InlineAllocationFlags[Index / 0x20] &= ~(1u << (Index % 0x20));
+			Image.NumFreeIndices++;
+		}
+
+		const UC::TSet<int32>& Get() const
+		{
+			return *reinterpret_cast<const UC::TSet<int32>*>(&Image);
+		}
+
+		int32 Find(int32 Value) const
+		{
+			return Get().FindIndexByHash(static_cast<uint32>(Value), [Value](int32 Element) -> bool { return Element == Value; });
+		}
+	};
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestSetFindIndexByHash<bDoDebugPrinting>();
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestSetFindIndexByHash()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		auto Check = [&](bool bCondition, const char* Description) -> void
+		{
+			if (bCondition)
+				return;
+
+			PrintDbgMessage<bDoDebugPrinting>("TSet::FindIndexByHash: {}", Description);
+			bSuccededTestWithoutError = false;
+		};
+
+		/* Buckets 0: { 0, 8, 4 }, 1: { 5, 1 }, 2: {}, 3: { 3 } */
+		const std::vector<int32> Values = { 0, 5, 8, 3, 1, 4 };
+
+		FInt32Set Set(Values, 0x4);
+
+		bool bFoundAllValues = true;
+
+		for (int32 i = 0; i < Values.size(); i++)
+			bFoundAllValues = bFoundAllValues && Set.Find(Values[i]) == i;
+
+		Check(bFoundAllValues, "Expected every element to be found at its index");
+		Check(Set.Find(12) == -1, "Expected no match at the end of a chain");
+		Check(Set.Find(2) == -1, "Expected no match in an empty bucket");
+
+		/* Elements of other buckets must not be visited */
+		int32 NumVisited = 0;
+		Set.Get().FindIndexByHash(0x0, [&NumVisited](int32) -> bool { NumVisited++; return false; });
+		Check(NumVisited == 0x3, "Expected only the three elements of bucket 0 to be visited");
+
+		/* A chain leading to a free slot ends the walk */
+		Set.Free(2);
+		Check(Set.Find(8) == -1 && Set.Find(0) == -1, "Expected the walk to stop at a free slot");
+
+		/* A chain looping back onto itself, as read while the engine modifies the set, is bounded by NumAllocated() */
+		FInt32Set LoopingSet(Values, 0x4);
+		LoopingSet.Elements[0].HashNextId = 5;
+		Check(LoopingSet.Find(12) == -1, "Expected the walk of a looping chain to end");
+
+		/* One bucket, stored in the inline-allocation of 'Hash' */
+		FInt32Set InlineHashSet(Values, 0x1);
+		Check(InlineHashSet.Find(3) == 3 && InlineHashSet.Find(7) == -1, "Expected lookups through the inline bucket");
+
+		FInt32Set EmptySet({}, 0x4);
+		Check(EmptySet.Find(0) == -1, "Expected no match in an empty set");
+
+		std::cerr << std::format("UnrealContainersTest::TestSetFindIndexByHash: {}\n", bSuccededTestWithoutError ? "succeeded" : "failed");
+	}
+
+private:
+	template<bool bDoDebugPrinting = false, typename... Ts>
+	static inline void PrintDbgMessage(std::format_string<Ts...> Message, Ts&&... Args)
+	{
+		if constexpr (bDoDebugPrinting)
+			std::cerr << std::format(Message, std::forward<Ts>(Args)...) << '\n';
+	}
+};
@@ -26,7 +26,7 @@ public:
 
     PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedMember* Predef);
 
-    PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop);
+    PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop, NameInfo PropName);
 
 public:
     std::string GetName() const;
@@ -95,7 +95,7 @@ private:
 public:
     FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedFunction* Predef);
 
-    FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func);
+    FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func, NameInfo FuncName);
 
 public:
     StructWrapper AsStruct() const;
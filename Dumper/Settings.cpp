@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <ranges>
 
 #include "Unreal/UnrealObjects.h"
 #include "Unreal/ObjectArray.h"
@@ -124,6 +125,13 @@ static void GenerateDefaultConfig(const std::string& Path)
 	Out << "; Delay in milliseconds before starting generation (default: 0)\n";
 	Out << "SleepTimeout=0\n";
 	Out << "\n";
+	Out << "; Comma-separated classes, structs or packages (e.g. PlayerController,FortniteGame).\n";
+	Out << "; Only these and everything they require are generated in the C++ SDK. Empty for the full SDK.\n";
+	Out << "SDKRootSet=\n";
+	Out << "\n";
+	Out << "; SDKIR.bin of a previous dump. If set, the mappings are generated from it without reading the game.\n";
+	Out << "IRFile=\n";
+	Out << "\n";
 	Out << "[PostRender]\n";
 	Out << "; Manual override for vtable indices. Set to -1 for auto-detect.\n";
 	Out << "GVCPostRenderIndex=-1\n";
@@ -182,6 +190,27 @@ void Settings::Config::Load(void* hModule)
 	SDKNamespaceName = SDKNamespace;
 	SleepTimeout = max(GetPrivateProfileIntA("Settings", "SleepTimeout", 0, ConfigPath), 0);
 
+	char RootSet[0x1000] = {};
+	GetPrivateProfileStringA("Settings", "SDKRootSet", "", RootSet, sizeof(RootSet), ConfigPath);
+
+	SDKRootSet.clear();
+
+	for (const auto Entry : std::string_view(RootSet) | std::views::split(','))
+	{
+		std::string_view Name(Entry.begin(), Entry.end());
+
+		const size_t First = Name.find_first_not_of(" \t");
+		const size_t Last = Name.find_last_not_of(" \t");
+
+		if (First != std::string_view::npos)
+			SDKRootSet.emplace_back(Name.substr(First, (Last - First) + 1));
+	}
+
+	char IRFile[MAX_PATH] = {};
+	GetPrivateProfileStringA("Settings", "IRFile", "", IRFile, sizeof(IRFile), ConfigPath);
+
+	IRFilePath = IRFile;
+
 	// [PostRender] section - manual override for vtable indices (-1 = auto-detect)
 	int GVCIdx = GetPrivateProfileIntA("PostRender", "GVCPostRenderIndex", -1, ConfigPath);
 	int HUDIdx = GetPrivateProfileIntA("PostRender", "HUDPostRenderIndex", -1, ConfigPath);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Unreal/Enums.h"
 
@@ -23,6 +24,12 @@ namespace Settings
 		inline std::string SDKNamespaceName = "SDK";
 		inline std::string DllDirectory;
 
+		/* Names of classes, structs or packages. If not empty, the C++ SDK only contains these and everything they require, see CppGenerator::InitPartialSDK() */
+		inline std::vector<std::string> SDKRootSet;
+
+		/* SDKIR file written by a previous dump. If set, only the generators consuming the IR run from it, and the game isn't read. See Generator::InitFromIRFile(). */
+		inline std::string IRFilePath;
+
 		void Load(void* hModule = nullptr);
 	};
 
@@ -48,6 +55,13 @@ namespace Settings
 		inline std::string GameVersion = "";
 
 		inline constexpr const char* SDKGenerationPath = "C:/Dumper-7";
+
+		/* Writes the resolved SDK (see IRManager) to 'IRFileName' in the dumper folder. Set the file as 'IRFile' in the config to run the mapping-generators from it, without the game. */
+		inline constexpr bool bWriteIRFile = false;
+		inline constexpr const char* IRFileName = "SDKIR.bin";
+
+		/* Stores content-hashes of all generated files in the dumper folder, so the next run only rewrites files that changed (see FileManifest). nullptr to clear all folders and regenerate every file. */
+		inline constexpr const char* ManifestFileName = "Manifest.d7";
 	}
 
 	namespace CppGenerator
@@ -87,6 +101,61 @@ R"(
 
 		/* Adds the 'final' specifier to classes with no loaded child class at SDK-generation time. */
 		constexpr bool bAddFinalSpecifier = true;
+
+		/*
+		* Embeds the object-index and FName of each class at generation time into its 'StaticClass()' and 'StaticName()'.
+		* The hinted slot is validated and tried first, so lookups are O(1) as long as the game wasn't updated. Indices change with every game update,
+		* which rewrites almost every '_classes.hpp' file when regenerating the SDK and forces a full recompile.
+		*/
+		constexpr bool bAddObjectIndexHints = false;
+
+		/*
+		* Generates an FName-keyed index of GObjects into Basic.cpp, which 'FindObject()', 'FindObjectFast()' and function lookups by FName go through.
+		* The index is built on first use and extended when new objects are added. Every name is only converted to a string once.
+		* Off by default, as the index keeps a vector of indices for every distinct name of GObjects alive for the runtime of the game.
+		*/
+		constexpr bool bGenerateObjectNameIndex = false;
+
+		/*
+		* Function wrappers load their UFunction from a per-class table, instead of looking it up by name through 'UClass::GetFunction()'.
+		* All functions of a class are resolved together on the first call to any of them. Not used if 'XORString' is set.
+		*/
+		constexpr bool bGenerateFunctionTables = false;
+
+		/*
+		* Generates 'EnumToString()' and 'StringToEnum()' for every enum, and 'ClassNameTable.hpp' with 'StaticClassByName()'.
+		* Names are looked up in constexpr perfect-hash tables built at SDK-generation time, with a single string-comparison per lookup.
+		*/
+		constexpr bool bGenerateNameTables = false;
+
+		/*
+		* Wrappers of native functions without input-parameters call the function's 'ExecFunction' directly, skipping ProcessEvent.
+		* All other functions, and functions of which 'ExecFunction' is nullptr at runtime, are still called through ProcessEvent.
+		*
+		* Limits: the stack-frame only has 'Node', 'Object' and 'Locals' set, 'Code' is nullptr and all other members are zeroed.
+		* Custom thunks stepping through 'Code', or using 'PreviousFrame', 'OutParms' or 'CurrentNativeFunction', must not be called this way.
+		* Script-callstacks and the blueprint-debugger don't see these calls, and hooks on ProcessEvent aren't invoked.
+		*/
+		constexpr bool bGenerateNativeFastPath = false;
+
+		/*
+		* Packages of which only enums are used are not included, instead their '_fwd.hpp' file containing opaque enum declarations is.
+		* Enums declared like 'enum class EFoo : uint8;' are complete types and can be used by value.
+		* Off by default, the include-structure of the SDK then stays the same as before and no '_fwd.hpp' files are generated.
+		*/
+		constexpr bool bGenerateForwardDeclarationHeaders = false;
+
+		/*
+		* Generates 'SDK_pch.hpp', a precompiled header containing Basic.hpp, CoreUObject and Engine, and groups all '_functions.cpp' files into
+		* 'NumUnityBuildFiles' unity translation units of similar size. The generated VS projects compile the unity files instead of single packages.
+		*/
+		constexpr bool bGenerateUnityBuild = false;
+
+		/* Number of 'Unity_N.cpp' files the '_functions.cpp' files are distributed to */
+		constexpr int32 NumUnityBuildFiles = 8;
+
+		/* With unity builds enabled, '_functions.cpp' files larger than this are split into '_functions_partN.cpp' files. Files are only split between structs. */
+		constexpr size_t MaxFunctionsFileSize = 0x200000;
 	}
 
 	namespace MappingGenerator
@@ -101,6 +170,18 @@ R"(
 		constexpr EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
 	}
 
+	namespace RemoteSDKGenerator
+	{
+		/* Generates 'RemoteSDK.hpp', views of all structs and classes for tools reading the game's memory from another process. See RemoteSDKGenerator. */
+		constexpr bool bGenerate = false;
+	}
+
+	namespace OffsetsGenerator
+	{
+		/* Generates 'SDKOffsets.hpp', constexpr offsets and sizes of all structs and classes with one header per package. See OffsetsGenerator. */
+		constexpr bool bGenerate = false;
+	}
+
 	/* Partially implemented  */
 	namespace Debug
 	{
@@ -120,6 +201,9 @@ R"(
 
 		/* Prints debug information during Mapping-Generation */
 		inline constexpr bool bShouldPrintMappingDebugData = false;
+
+		/* Runs the tests in Generator/Public/UnitTests against the objects of the game, after the managers were initialized */
+		inline constexpr bool bRunUnitTests = false;
 	}
 
 	//* * * * * * * * * * * * * * * * * * * * *// 
@@ -7,9 +7,16 @@
 #include "Generators/MappingGenerator.h"
 #include "Generators/IDAMappingGenerator.h"
 #include "Generators/DumpspaceGenerator.h"
+#include "Generators/RemoteSDKGenerator.h"
+#include "Generators/OffsetsGenerator.h"
 
 #include "Generators/Generator.h"
 
+#include "UnitTests/MemberManagerTest.h"
+#include "UnitTests/CppGeneratorTest.h"
+#include "UnitTests/IRGeneratorTest.h"
+#include "UnitTests/UnrealContainersTest.h"
+
 enum class EFortToastType : uint8
 {
         Default                        = 0,
@@ -18,28 +25,19 @@ enum class EFortToastType : uint8
         EFortToastType_MAX             = 3,
 };
 
-DWORD MainThread(HMODULE Module)
+void GenerateFromGame()
 {
-	AllocConsole();
-	FILE* Dummy;
-	freopen_s(&Dummy, "CONOUT$", "w", stderr);
-	freopen_s(&Dummy, "CONIN$", "r", stdin);
-
-	std::cerr << "Started Generation [Dumper-7]!\n";
-
-	Settings::Config::Load(Module);
+	Generator::InitEngineCore();
+	Generator::InitInternal();
 
-	if (Settings::Config::SleepTimeout > 0)
+	if constexpr (Settings::Debug::bRunUnitTests)
 	{
-		std::cerr << "Sleeping for " << Settings::Config::SleepTimeout << "ms...\n";
-		Sleep(Settings::Config::SleepTimeout);
+		MemberManagerTest::TestAll<true>();
+		CppGeneratorTest::TestAll<true>();
+		IRGeneratorTest::TestAll<true>();
+		UnrealContainersTest::TestAll<true>();
 	}
 
-	auto DumpStartTime = std::chrono::high_resolution_clock::now();
-
-	Generator::InitEngineCore();
-	Generator::InitInternal();
-
 	if (Settings::Generator::GameName.empty() && Settings::Generator::GameVersion.empty())
 	{
 		// Only Possible in Main()
@@ -66,6 +64,53 @@ DWORD MainThread(HMODULE Module)
 	Generator::Generate<IDAMappingGenerator>();
 	Generator::Generate<DumpspaceGenerator>();
 
+	if constexpr (Settings::RemoteSDKGenerator::bGenerate)
+		Generator::Generate<RemoteSDKGenerator>();
+
+	if constexpr (Settings::OffsetsGenerator::bGenerate)
+		Generator::Generate<OffsetsGenerator>();
+}
+
+/* Mappings only need the IR, they can be regenerated from the file of a previous dump without reading the game */
+void GenerateFromIRFile(const std::string& FilePath)
+{
+	std::cerr << "Loading SDKIR from '" << FilePath << "'\n\n";
+
+	if (!Generator::InitFromIRFile(FilePath))
+		return;
+
+	Generator::Generate<MappingGenerator>();
+	Generator::Generate<IDAMappingGenerator>();
+}
+
+DWORD MainThread(HMODULE Module)
+{
+	AllocConsole();
+	FILE* Dummy;
+	freopen_s(&Dummy, "CONOUT$", "w", stderr);
+	freopen_s(&Dummy, "CONIN$", "r", stdin);
+
+	std::cerr << "Started Generation [Dumper-7]!\n";
+
+	Settings::Config::Load(Module);
+
+	if (Settings::Config::SleepTimeout > 0)
+	{
+		std::cerr << "Sleeping for " << Settings::Config::SleepTimeout << "ms...\n";
+		Sleep(Settings::Config::SleepTimeout);
+	}
+
+	auto DumpStartTime = std::chrono::high_resolution_clock::now();
+
+	if (!Settings::Config::IRFilePath.empty())
+	{
+		GenerateFromIRFile(Settings::Config::IRFilePath);
+	}
+	else
+	{
+		GenerateFromGame();
+	}
+
 	auto DumpFinishTime = std::chrono::high_resolution_clock::now();
 
 	std::chrono::duration<double, std::milli> DumpTime = DumpFinishTime - DumpStartTime;